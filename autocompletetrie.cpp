@@ -0,0 +1,202 @@
+#include "autocompletetrie.h"
+
+#include "catalogcolumns.h"
+#include "chinesetext.h"
+
+#include <QSet>
+
+#include <algorithm>
+#include <queue>
+
+namespace {
+
+quint64 edgeKey(int node, QChar c)
+{
+    return quint64(node) << 16 | c.unicode();
+}
+
+} // namespace
+
+void AutocompleteTrie::clear()
+{
+    label_ = { QChar() };
+    parent_ = { -1 };
+    firstChild_ = { -1 };
+    nextSibling_ = { -1 };
+    maxWeight_ = { -1 };
+    terminalOf_ = { -1 };
+    edges_.clear();
+    terminals_.clear();
+    rowWeight_.clear();
+    for (QVector<int> &nodes : rowNode_) nodes.clear();
+}
+
+void AutocompleteTrie::rebuild(const CatalogColumns &columns)
+{
+    clear();
+    const int n = columns.size();
+    rowWeight_ = columns.borrowCounts();
+    for (QVector<int> &nodes : rowNode_) nodes.fill(-1, n);
+    for (int row = 0; row < n; ++row) {
+        attach(row, NameKind, columns.name(row));
+        attach(row, IndexIdKind, columns.indexId(row));
+    }
+}
+
+void AutocompleteTrie::insert(int row, const CatalogColumns &columns)
+{
+    if (label_.isEmpty()) clear();
+    Q_ASSERT(row == rowWeight_.size());
+    rowWeight_.append(columns.borrowCount(row));
+    for (QVector<int> &nodes : rowNode_) nodes.append(-1);
+    attach(row, NameKind, columns.name(row));
+    attach(row, IndexIdKind, columns.indexId(row));
+}
+
+void AutocompleteTrie::update(int row, const CatalogColumns &columns)
+{
+    detach(row, NameKind);
+    detach(row, IndexIdKind);
+    rowWeight_[row] = columns.borrowCount(row);
+    attach(row, NameKind, columns.name(row));
+    attach(row, IndexIdKind, columns.indexId(row));
+}
+
+void AutocompleteTrie::setWeight(int row, int weight)
+{
+    rowWeight_[row] = weight;
+    for (const QVector<int> &nodes : rowNode_) {
+        if (nodes[row] >= 0) refreshTerminal(nodes[row]);
+    }
+}
+
+void AutocompleteTrie::removeRow(int row)
+{
+    detach(row, NameKind);
+    detach(row, IndexIdKind);
+    rowWeight_.removeAt(row);
+    for (QVector<int> &nodes : rowNode_) nodes.removeAt(row);
+    for (Terminal &t : terminals_) {
+        for (auto p = std::upper_bound(t.rows.begin(), t.rows.end(), row); p != t.rows.end(); ++p) {
+            --*p;
+        }
+    }
+}
+
+QStringList AutocompleteTrie::suggest(const QString &prefix, int limit) const
+{
+    QStringList result;
+    if (limit <= 0 || label_.isEmpty()) return result;
+    int node = 0;
+    for (QChar c : ChineseText::normalize(prefix)) {
+        node = child(node, c);
+        if (node < 0) return result;
+    }
+
+    // 最大权重优先：节点以子树最大权重入队，词尾以自身权重入队，弹出的词尾即按权重降序
+    struct Item {
+        int weight;
+        bool terminal;
+        int node;
+        bool operator<(const Item &other) const
+        {
+            if (weight != other.weight) return weight < other.weight;
+            return terminal < other.terminal;   // 同权重时先取词尾，较短的文本排在前面
+        }
+    };
+    std::priority_queue<Item> queue;
+    if (maxWeight_[node] >= 0) queue.push(Item{ maxWeight_[node], false, node });
+    QSet<QString> seen;
+    while (!queue.empty() && result.size() < limit) {
+        const Item item = queue.top();
+        queue.pop();
+        if (item.terminal) {
+            const QString &text = terminals_[terminalOf_[item.node]].text;
+            if (!seen.contains(text)) {
+                seen.insert(text);
+                result.append(text);
+            }
+            continue;
+        }
+        const int t = terminalOf_[item.node];
+        if (t >= 0 && terminals_[t].weight >= 0) queue.push(Item{ terminals_[t].weight, true, item.node });
+        for (int c = firstChild_[item.node]; c >= 0; c = nextSibling_[c]) {
+            if (maxWeight_[c] >= 0) queue.push(Item{ maxWeight_[c], false, c });
+        }
+    }
+    return result;
+}
+
+int AutocompleteTrie::child(int node, QChar c) const
+{
+    return edges_.value(edgeKey(node, c), -1);
+}
+
+int AutocompleteTrie::findOrAddPath(const QString &key)
+{
+    int node = 0;
+    for (QChar c : key) {
+        int next = child(node, c);
+        if (next < 0) {
+            next = label_.size();
+            label_.append(c);
+            parent_.append(node);
+            firstChild_.append(-1);
+            nextSibling_.append(firstChild_[node]);
+            maxWeight_.append(-1);
+            terminalOf_.append(-1);
+            firstChild_[node] = next;
+            edges_.insert(edgeKey(node, c), next);
+        }
+        node = next;
+    }
+    return node;
+}
+
+void AutocompleteTrie::attach(int row, Kind kind, const QString &text)
+{
+    const QString key = ChineseText::normalize(text);
+    if (key.isEmpty()) return;
+    const int node = findOrAddPath(key);
+    if (terminalOf_[node] < 0) {
+        terminalOf_[node] = terminals_.size();
+        terminals_.append(Terminal());
+    }
+    Terminal &t = terminals_[terminalOf_[node]];
+    // 同一归一化键下显示最先收录的原文
+    if (t.rows.isEmpty()) t.text = text;
+    t.rows.insert(std::lower_bound(t.rows.begin(), t.rows.end(), row), row);
+    rowNode_[kind][row] = node;
+    refreshTerminal(node);
+}
+
+void AutocompleteTrie::detach(int row, Kind kind)
+{
+    const int node = rowNode_[kind][row];
+    if (node < 0) return;
+    rowNode_[kind][row] = -1;
+    QVector<int> &rows = terminals_[terminalOf_[node]].rows;
+    const auto pos = std::lower_bound(rows.begin(), rows.end(), row);
+    if (pos != rows.end() && *pos == row) rows.erase(pos);
+    refreshTerminal(node);
+}
+
+void AutocompleteTrie::refreshTerminal(int node)
+{
+    Terminal &t = terminals_[terminalOf_[node]];
+    t.weight = -1;
+    for (int row : t.rows) t.weight = qMax(t.weight, rowWeight_[row]);
+    propagate(node);
+}
+
+void AutocompleteTrie::propagate(int node)
+{
+    // 沿父链重算子树最大权重，某一层没有变化时上面各层也不会变
+    for (; node >= 0; node = parent_[node]) {
+        const int t = terminalOf_[node];
+        int weight = t >= 0 ? terminals_[t].weight : -1;
+        for (int c = firstChild_[node]; c >= 0; c = nextSibling_[c]) weight = qMax(weight, maxWeight_[c]);
+        if (weight == maxWeight_[node]) break;
+        maxWeight_[node] = weight;
+    }
+}
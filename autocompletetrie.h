@@ -0,0 +1,68 @@
+#ifndef AUTOCOMPLETETRIE_H
+#define AUTOCOMPLETETRIE_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class CatalogColumns;
+
+// 搜索框自动补全用的前缀树，收录书名和索引号（归一化后，见 chinesetext.h）
+//
+// 节点按下标存放在几组平行数组中（标签、父节点、首个子节点、下一个兄弟），
+// 边另由 (父节点, 字符) -> 子节点 的哈希表定位，逐字下行每步 O(1)。
+// 每个节点记录子树中的最大权重（借阅次数），补全时从前缀节点出发按最大权重优先展开，
+// 取前 K 条只访问与 K 相关的少数节点，不枚举整棵子树。
+// 借还改变借阅次数时只沿父链更新最大权重；节点不回收，没有图书的子树权重为 -1，查询时跳过。
+// 行号与 LibraryManager 中的下标一致，删除图书后由 removeRow 整体前移。
+class AutocompleteTrie {
+public:
+    void clear();
+    void rebuild(const CatalogColumns &columns);
+
+    // row 必须等于当前行数：LibraryManager 只在末尾追加图书
+    void insert(int row, const CatalogColumns &columns);
+    // 书名或索引号变化后按 columns 中的新值重新挂接
+    void update(int row, const CatalogColumns &columns);
+    void setWeight(int row, int weight);
+    void removeRow(int row);
+
+    // 以 prefix 开头的书名/索引号，按权重降序，相同文本只出现一次
+    QStringList suggest(const QString &prefix, int limit) const;
+
+private:
+    enum Kind {
+        NameKind,
+        IndexIdKind,
+        KindCount
+    };
+    struct Terminal {
+        QString text;        // 显示用的原始文本
+        QVector<int> rows;   // 升序
+        int weight = -1;     // rows 中的最大权重
+    };
+
+    int child(int node, QChar c) const;
+    int findOrAddPath(const QString &key);
+    void attach(int row, Kind kind, const QString &text);
+    void detach(int row, Kind kind);
+    void refreshTerminal(int node);
+    void propagate(int node);
+
+private:
+    // 节点 0 为根
+    QVector<QChar> label_;
+    QVector<int> parent_;
+    QVector<int> firstChild_;
+    QVector<int> nextSibling_;
+    QVector<int> maxWeight_;
+    QVector<int> terminalOf_;   // 节点 -> terminals_ 下标，-1 表示不是词尾
+    QHash<quint64, int> edges_;
+    QVector<Terminal> terminals_;
+
+    QVector<int> rowWeight_;
+    QVector<int> rowNode_[KindCount];   // 行 -> 所在词尾节点，-1 表示没有（空字符串）
+};
+
+#endif // AUTOCOMPLETETRIE_H
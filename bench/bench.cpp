@@ -0,0 +1,346 @@
+// 性能基准：不带参数时运行全部项目，也可以只给出项目名。
+// 每项打印各自的耗时（load 另有进程内存峰值）；目录内容由固定种子生成，多次运行可比。
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QSaveFile>
+#include <QStringList>
+#include <QTemporaryDir>
+
+#include "book.h"
+#include "bookfields.h"
+#include "catalogcolumns.h"
+#include "catalogreader.h"
+#include "columnkernels.h"
+#include "librarymanager.h"
+#include "queryplanner.h"
+
+#include <cstdio>
+#include <limits>
+#include <random>
+
+namespace {
+
+volatile qint64 sink = 0;   // 吞掉结果，避免被优化掉
+
+Book makeBook(std::mt19937 &rng, int id)
+{
+    static const char *const categories[] = { "人文", "科技", "外语", "艺术", "经济" };
+    static const char *const locations[] = { "三牌楼", "仙林" };
+    Book b;
+    b.indexId = QStringLiteral("B") + QString::number(id);
+    b.name = QStringLiteral("图书") + QString::number(int(rng() % 100000));
+    b.category = QString::fromUtf8(categories[rng() % 5]);
+    b.location = QString::fromUtf8(locations[rng() % 2]);
+    b.quantity = int(rng() % 5) + 1;
+    b.price = double(rng() % 20000) / 100.0;
+    b.inDate = QDate(2015, 1, 1).addDays(int(rng() % 3650));
+    b.borrowCount = int(rng() % 200);
+    b.available = rng() % 4 != 0;
+    if (!b.available) b.returnDate = QDate(2025, 1, 1).addDays(int(rng() % 60));
+    return b;
+}
+
+QVector<Book> makeBooks(int n)
+{
+    std::mt19937 rng(20240601);
+    QVector<Book> books;
+    books.reserve(n);
+    for (int i = 0; i < n; ++i) books.append(makeBook(rng, i));
+    return books;
+}
+
+CatalogColumns makeColumns(const QVector<Book> &books)
+{
+    CatalogColumns columns;
+    columns.reserve(books.size());
+    for (const Book &b : books) columns.append(b);
+    return columns;
+}
+
+// 写成 loadFromFile 读取的 JSON 目录
+bool writeCatalog(const QString &filePath, const QVector<Book> &books)
+{
+    QJsonArray arr;
+    for (const Book &b : books) {
+        QJsonObject obj;
+        toJson(obj, b);
+        arr.append(obj);
+    }
+    QSaveFile f(filePath);
+    if (!f.open(QIODevice::WriteOnly)) return false;
+    f.write(QJsonDocument(arr).toJson(QJsonDocument::Compact));
+    return f.commit();
+}
+
+// 先预热一次，再连续运行直到累计超过 200 ms，返回每次的平均微秒数
+template <typename F>
+double timeUs(F f)
+{
+    f();
+    QElapsedTimer timer;
+    timer.start();
+    int runs = 0;
+    do {
+        f();
+        ++runs;
+    } while (timer.nsecsElapsed() < 200 * 1000 * 1000);
+    return timer.nsecsElapsed() / 1000.0 / runs;
+}
+
+const char *levelName(ColumnKernels::Level level)
+{
+    switch (level) {
+    case ColumnKernels::ScalarLevel: return "标量";
+    case ColumnKernels::Sse2Level: return "SSE2";
+    case ColumnKernels::Avx2Level: return "AVX2";
+    }
+    return "?";
+}
+
+// 价格区间与入库日期两个谓词：逐本 Book 比较（改为列存储之前的写法）对比列上的各级内核
+void benchKernels()
+{
+    const int n = 1000000;
+    const QVector<Book> books = makeBooks(n);
+    const CatalogColumns columns = makeColumns(books);
+    const double lo = 50.0;
+    const double hi = 80.0;
+    const QDate cutoff = QDate(2024, 1, 1);
+    const qint32 cutoffDay = CatalogColumns::toDay(cutoff);
+
+    std::printf("== kernels：%d 本，价格 [%.0f, %.0f] / 入库日期 >= %s，生成行号列表\n",
+                n, lo, hi, qPrintable(cutoff.toString(Qt::ISODate)));
+    const double priceLoop = timeUs([&]() {
+        QVector<int> rows;
+        for (int i = 0; i < books.size(); ++i) {
+            if (books[i].price >= lo && books[i].price <= hi) rows.append(i);
+        }
+        sink += rows.size();
+    });
+    const double dateLoop = timeUs([&]() {
+        QVector<int> rows;
+        for (int i = 0; i < books.size(); ++i) {
+            if (books[i].inDate.isValid() && books[i].inDate >= cutoff) rows.append(i);
+        }
+        sink += rows.size();
+    });
+    std::printf("  价格 %9.0f us   日期 %9.0f us   逐本 Book\n", priceLoop, dateLoop);
+
+    const ColumnKernels::Level detected = ColumnKernels::level();
+    QVector<quint64> bits(ColumnKernels::wordCount(n));
+    for (ColumnKernels::Level level : { ColumnKernels::ScalarLevel, ColumnKernels::Sse2Level, ColumnKernels::Avx2Level }) {
+        ColumnKernels::setLevel(level);
+        if (ColumnKernels::level() != level) {
+            std::printf("  CPU 不支持 %s，跳过\n", levelName(level));
+            continue;
+        }
+        const double price = timeUs([&]() {
+            ColumnKernels::selectInRange(columns.prices().constData(), n, lo, hi, bits.data());
+            sink += ColumnKernels::rowsOf(bits.constData(), n).size();
+        });
+        const double date = timeUs([&]() {
+            ColumnKernels::selectInRange(columns.inDays().constData(), n, cutoffDay,
+                                         std::numeric_limits<qint32>::max(), bits.data());
+            sink += ColumnKernels::rowsOf(bits.constData(), n).size();
+        });
+        std::printf("  价格 %9.0f us   日期 %9.0f us   列 + %s 内核\n", price, date, levelName(level));
+    }
+    ColumnKernels::setLevel(detected);
+}
+
+// 整列的筛选与统计：逐本 Book（QVector<Book> 存储时的写法）对比列存储上的单列循环
+void benchColumns()
+{
+    const int n = 1000000;
+    const QVector<Book> books = makeBooks(n);
+    const CatalogColumns columns = makeColumns(books);
+    std::printf("== columns：%d 本，整列筛选与统计\n", n);
+
+    const double valueBooks = timeUs([&]() {
+        double total = 0.0;
+        for (const Book &b : books) total += b.price * b.quantity;
+        sink += qint64(total);
+    });
+    const double valueColumns = timeUs([&]() {
+        const double *prices = columns.prices().constData();
+        const int *quantities = columns.quantities().constData();
+        double total = 0.0;
+        for (int i = 0; i < n; ++i) total += prices[i] * quantities[i];
+        sink += qint64(total);
+    });
+    std::printf("  逐本 Book %9.0f us   列 %9.0f us   总价值\n", valueBooks, valueColumns);
+
+    const double availableBooks = timeUs([&]() {
+        int count = 0;
+        for (const Book &b : books) count += b.available && b.quantity > 0;
+        sink += count;
+    });
+    // recomputeStatistics 的写法：数量列比较出位图，与可借位图求与后计数
+    const double availableColumns = timeUs([&]() {
+        sink += ColumnKernels::countBits(QueryPlanner::availableSelection(columns).constData(), n);
+    });
+    std::printf("  逐本 Book %9.0f us   列 %9.0f us   可借数量\n", availableBooks, availableColumns);
+
+    const double popularBooks = timeUs([&]() {
+        QVector<int> rows;
+        for (int i = 0; i < books.size(); ++i) {
+            if (books[i].borrowCount >= 150) rows.append(i);
+        }
+        sink += rows.size();
+    });
+    const double popularColumns = timeUs([&]() {
+        const int *counts = columns.borrowCounts().constData();
+        QVector<int> rows;
+        for (int i = 0; i < n; ++i) {
+            if (counts[i] >= 150) rows.append(i);
+        }
+        sink += rows.size();
+    });
+    std::printf("  逐本 Book %9.0f us   列 %9.0f us   借阅次数 >= 150 的行\n", popularBooks, popularColumns);
+}
+
+// 按索引号查找：LibraryManager::indexOf（哈希索引）对比逐行扫描索引号列（加哈希索引之前的写法）
+void benchLookup()
+{
+    QTemporaryDir dir;
+    std::printf("== lookup：按索引号查找，每次查找的平均耗时\n");
+    for (int n : { 10000, 100000, 1000000 }) {
+        const QVector<Book> books = makeBooks(n);
+        const QString path = dir.filePath(QStringLiteral("lookup.json"));
+        LibraryManager library;
+        if (!writeCatalog(path, books) || !library.loadFromFile(path)) {
+            std::printf("  %d 本：无法生成目录，跳过\n", n);
+            continue;
+        }
+        std::mt19937 rng(n);
+        QVector<QString> keys;
+        for (int i = 0; i < 1024; ++i) keys.append(books[int(rng() % n)].indexId);
+
+        const double hashed = timeUs([&]() {
+            for (const QString &key : keys) sink += library.indexOf(key);
+        }) / keys.size();
+        // 逐行扫描每次只查少数几个，否则大目录上一轮就要数秒
+        const QVector<QString> &ids = library.columns().indexIds();
+        const double scanned = timeUs([&]() {
+            for (int k = 0; k < 8; ++k) {
+                const QString &key = keys[k];
+                int row = -1;
+                for (int i = 0; i < ids.size(); ++i) {
+                    if (ids[i] == key) {
+                        row = i;
+                        break;
+                    }
+                }
+                sink += row;
+            }
+        }) / 8;
+        std::printf("  %8d 本   哈希索引 %10.3f us   逐行扫描 %10.1f us\n", n, hashed, scanned);
+    }
+}
+
+// 进程的内存峰值（KiB），只在 Linux 上可取，其他平台返回 -1
+qint64 peakRssKb()
+{
+#ifdef Q_OS_LINUX
+    QFile f(QStringLiteral("/proc/self/status"));
+    if (!f.open(QIODevice::ReadOnly)) return -1;
+    for (const QByteArray &line : f.readAll().split('\n')) {
+        if (line.startsWith("VmHWM:")) return line.mid(6).trimmed().split(' ').value(0).toLongLong();
+    }
+#endif
+    return -1;
+}
+
+// 子进程：按 mode 加载一次 filePath，打印 "毫秒 内存峰值KiB 图书数"。
+// 每种方式单独起一个进程，内存峰值互不干扰
+int runLoadChild(const QString &mode, const QString &filePath)
+{
+    QElapsedTimer timer;
+    timer.start();
+    int count = -1;
+    if (mode == QLatin1String("document")) {
+        // 流式读取之前的写法：readAll 后整体建成 QJsonDocument，再逐个 QJsonObject 转换
+        QFile f(filePath);
+        if (f.open(QIODevice::ReadOnly)) {
+            const QJsonArray arr = QJsonDocument::fromJson(f.readAll()).array();
+            CatalogColumns columns;
+            columns.reserve(arr.size());
+            for (const QJsonValue &v : arr) columns.append(fromJson(v.toObject()));
+            count = columns.size();
+        }
+    } else if (mode == QLatin1String("stream")) {
+        QFile f(filePath);
+        if (f.open(QIODevice::ReadOnly)) {
+            CatalogJsonReader reader(&f);
+            CatalogColumns columns;
+            Book b;
+            while (reader.readNext(&b)) columns.append(b);
+            count = reader.hasError() ? -1 : columns.size();
+        }
+    } else if (mode == QLatin1String("library")) {
+        LibraryManager library;
+        if (library.loadFromFile(filePath)) count = library.count();
+    }
+    std::printf("%lld %lld %d\n", timer.elapsed(), peakRssKb(), count);
+    return count < 0 ? 1 : 0;
+}
+
+// 加载 JSON 目录：整体建 QJsonDocument 对比流式读取（都只填充列存储），
+// 另列出 loadFromFile 含全部索引重建的总耗时。各自在子进程中运行以取得内存峰值
+void benchLoad()
+{
+    QTemporaryDir dir;
+    const QString path = dir.filePath(QStringLiteral("load.json"));
+    std::printf("== load：加载 JSON 目录的耗时与进程内存峰值（只在 Linux 上统计）\n");
+    for (int n : { 100000, 1000000 }) {
+        if (!writeCatalog(path, makeBooks(n))) {
+            std::printf("  %d 本：无法生成目录，跳过\n", n);
+            continue;
+        }
+        const double mb = QFile(path).size() / 1048576.0;
+        for (const char *mode : { "document", "stream", "library" }) {
+            QProcess child;
+            child.start(QCoreApplication::applicationFilePath(),
+                        { QStringLiteral("--load-child"), QLatin1String(mode), path });
+            child.waitForFinished(-1);
+            const QList<QByteArray> fields = child.readAllStandardOutput().trimmed().split(' ');
+            if (child.exitCode() != 0 || fields.size() != 3) {
+                std::printf("  %8d 本 (%.0f MB)   %-8s 失败\n", n, mb, mode);
+                continue;
+            }
+            std::printf("  %8d 本 (%.0f MB)   %-8s %7lld ms   峰值 %8lld KiB\n", n, mb, mode,
+                        fields[0].toLongLong(), fields[1].toLongLong());
+        }
+    }
+}
+
+struct Benchmark {
+    const char *name;
+    void (*run)();
+};
+
+const Benchmark kBenchmarks[] = {
+    { "columns", benchColumns },
+    { "kernels", benchKernels },
+    { "lookup", benchLookup },
+    { "load", benchLoad },
+};
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    const QStringList args = app.arguments();
+    if (args.value(1) == QLatin1String("--load-child")) return runLoadChild(args.value(2), args.value(3));
+    const QStringList selected = args.mid(1);
+    for (const Benchmark &b : kBenchmarks) {
+        if (selected.isEmpty() || selected.contains(QLatin1String(b.name))) b.run();
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+QT       -= gui
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+TARGET = bench
+
+# 性能基准，与主程序共用源文件：qmake && make && ./bench [项目名...]
+INCLUDEPATH += ..
+
+SOURCES += \
+    bench.cpp \
+    ../librarymanager.cpp \
+    ../catalogcolumns.cpp \
+    ../columnkernels.cpp \
+    ../stringdictionary.cpp \
+    ../bookview.cpp \
+    ../catalogreader.cpp \
+    ../catalogsnapshot.cpp \
+    ../checksum.cpp \
+    ../circulationjournal.cpp \
+    ../postinglistindex.cpp \
+    ../priceindex.cpp \
+    ../duedateindex.cpp \
+    ../borrowrankindex.cpp \
+    ../ngramindex.cpp \
+    ../pinyinindex.cpp \
+    ../autocompletetrie.cpp \
+    ../searchsnapshot.cpp \
+    ../catalogquery.cpp \
+    ../queryplanner.cpp \
+    ../sortpermutations.cpp \
+    ../sortengine.cpp \
+    ../chinesetext.cpp \
+    ../chinesetextdata.cpp
+
+HEADERS += \
+    ../book.h \
+    ../librarymanager.h \
+    ../catalogcolumns.h \
+    ../columnkernels.h \
+    ../stringdictionary.h \
+    ../bookview.h \
+    ../catalogreader.h \
+    ../catalogsnapshot.h \
+    ../checksum.h \
+    ../circulationjournal.h \
+    ../postinglistindex.h \
+    ../priceindex.h \
+    ../duedateindex.h \
+    ../borrowrankindex.h \
+    ../ngramindex.h \
+    ../pinyinindex.h \
+    ../autocompletetrie.h \
+    ../searchsnapshot.h \
+    ../catalogquery.h \
+    ../queryplanner.h \
+    ../sortpermutations.h \
+    ../sortengine.h \
+    ../bookfields.h \
+    ../chinesetext.h \
+    ../chinesetextdata.h
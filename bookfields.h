@@ -0,0 +1,232 @@
+#ifndef BOOKFIELDS_H
+#define BOOKFIELDS_H
+
+#include <QDate>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <QVector>
+
+#include <utility>
+
+#include "book.h"
+#include "catalogcolumns.h"
+#include "catalogquery.h"
+
+// 图书字段的编译期描述
+//
+// 每个字段是一个空的标签类型，静态成员给出 Book 成员的读写、JSON 键与编解码，
+// 以及列存储上的取值键 key(columns)：row -> 可直接比较的值（文本、数值、儒略日，
+// 书名为拼音排序键，分类/馆藏地址为字典序名次）。排序、区间筛选和 JSON 序列化都写成以标签为模板参数的函数，
+// 按字段各实例化一份，取值和比较全部内联，没有虚函数，也不按字符串查找字段。
+// 新增字段时在这里加一个标签并加入 forEachField / visitField，各处即可使用。
+namespace BookFields {
+
+// 列上的取值键
+template <typename T>
+struct ColumnKey {
+    const T *values;
+    const T &operator()(int row) const { return values[row]; }
+};
+
+// 字典编码列按取值字典序的名次比较，不逐行比较字符串
+struct RankKey {
+    QVector<int> ranks;
+    const int *codes;
+    int operator()(int row) const { return ranks[codes[row]]; }
+};
+
+struct BitKey {
+    const quint64 *bits;
+    bool operator()(int row) const { return (bits[row >> 6] >> (row & 63)) & 1; }
+};
+
+template <typename T, T Book::*M>
+struct MemberField {
+    typedef T Value;
+    static constexpr bool numeric = false;   // 可做区间筛选
+    static constexpr bool dated = false;     // 取值为儒略日，kNoDay 表示没有日期
+    static const T &get(const Book &b) { return b.*M; }
+    static void set(Book &b, const T &value) { b.*M = value; }
+};
+
+template <QString Book::*M>
+struct TextField : MemberField<QString, M> {
+    static QJsonValue toJson(const QString &value) { return value; }
+    static QString fromJson(const QJsonValue &value) { return value.toString(); }
+};
+
+template <typename T, T Book::*M>
+struct NumberField : MemberField<T, M> {
+    static constexpr bool numeric = true;
+    static QJsonValue toJson(T value) { return value; }
+};
+
+template <QDate Book::*M>
+struct DateField : MemberField<QDate, M> {
+    static constexpr bool numeric = true;
+    static constexpr bool dated = true;
+    // 无效日期写成空字符串
+    static QJsonValue toJson(const QDate &value) { return value.isValid() ? value.toString(Qt::ISODate) : QString(); }
+    static QDate fromJson(const QJsonValue &value)
+    {
+        const QString text = value.toString();
+        return text.isEmpty() ? QDate() : QDate::fromString(text, Qt::ISODate);
+    }
+};
+
+struct IndexId : TextField<&Book::indexId> {
+    static constexpr const char *jsonKey = "indexId";
+    static ColumnKey<QString> key(const CatalogColumns &c) { return { c.indexIds().constData() }; }
+};
+
+struct Name : TextField<&Book::name> {
+    static constexpr const char *jsonKey = "name";
+    // 按拼音排序键比较，不按 UTF-16 码元
+    static ColumnKey<QByteArray> key(const CatalogColumns &c) { return { c.nameKeys().constData() }; }
+};
+
+struct Location : TextField<&Book::location> {
+    static constexpr const char *jsonKey = "location";
+    static const StringDictionary &dictionary(const CatalogColumns &c) { return c.locationDictionary(); }
+    static const QVector<int> &codes(const CatalogColumns &c) { return c.locationCodes(); }
+    static RankKey key(const CatalogColumns &c) { return { dictionary(c).sortRanks(), codes(c).constData() }; }
+};
+
+struct Category : TextField<&Book::category> {
+    static constexpr const char *jsonKey = "category";
+    static const StringDictionary &dictionary(const CatalogColumns &c) { return c.categoryDictionary(); }
+    static const QVector<int> &codes(const CatalogColumns &c) { return c.categoryCodes(); }
+    static RankKey key(const CatalogColumns &c) { return { dictionary(c).sortRanks(), codes(c).constData() }; }
+};
+
+struct Quantity : NumberField<int, &Book::quantity> {
+    static constexpr const char *jsonKey = "quantity";
+    static int fromJson(const QJsonValue &value) { return value.toInt(); }
+    static ColumnKey<int> key(const CatalogColumns &c) { return { c.quantities().constData() }; }
+};
+
+struct Price : NumberField<double, &Book::price> {
+    static constexpr const char *jsonKey = "price";
+    static double fromJson(const QJsonValue &value) { return value.toDouble(); }
+    static ColumnKey<double> key(const CatalogColumns &c) { return { c.prices().constData() }; }
+};
+
+struct InDate : DateField<&Book::inDate> {
+    static constexpr const char *jsonKey = "inDate";
+    static ColumnKey<qint32> key(const CatalogColumns &c) { return { c.inDays().constData() }; }
+};
+
+struct ReturnDate : DateField<&Book::returnDate> {
+    static constexpr const char *jsonKey = "returnDate";
+    static ColumnKey<qint32> key(const CatalogColumns &c) { return { c.returnDays().constData() }; }
+};
+
+struct BorrowCount : NumberField<int, &Book::borrowCount> {
+    static constexpr const char *jsonKey = "borrowCount";
+    static int fromJson(const QJsonValue &value) { return value.toInt(); }
+    static ColumnKey<int> key(const CatalogColumns &c) { return { c.borrowCounts().constData() }; }
+};
+
+struct Available : MemberField<bool, &Book::available> {
+    static constexpr const char *jsonKey = "available";
+    static QJsonValue toJson(bool value) { return value; }
+    // 缺省为可借
+    static bool fromJson(const QJsonValue &value) { return value.toBool(true); }
+    static BitKey key(const CatalogColumns &c) { return { c.availableBits().constData() }; }
+};
+
+// 按 JSON 中的顺序对每个字段调用 visitor(标签)
+template <typename Visitor>
+void forEachField(Visitor &&visitor)
+{
+    visitor(IndexId());
+    visitor(Name());
+    visitor(Location());
+    visitor(Category());
+    visitor(Quantity());
+    visitor(Price());
+    visitor(InDate());
+    visitor(ReturnDate());
+    visitor(BorrowCount());
+    visitor(Available());
+}
+
+// 运行时的字段编号分派到标签；AnyTextField 没有对应的单个字段，返回 false
+template <typename Visitor>
+bool visitField(QueryPredicate::Field field, Visitor &&visitor)
+{
+    switch (field) {
+    case QueryPredicate::NameField: visitor(Name()); return true;
+    case QueryPredicate::IndexIdField: visitor(IndexId()); return true;
+    case QueryPredicate::CategoryField: visitor(Category()); return true;
+    case QueryPredicate::LocationField: visitor(Location()); return true;
+    case QueryPredicate::QuantityField: visitor(Quantity()); return true;
+    case QueryPredicate::PriceField: visitor(Price()); return true;
+    case QueryPredicate::InDateField: visitor(InDate()); return true;
+    case QueryPredicate::ReturnDateField: visitor(ReturnDate()); return true;
+    case QueryPredicate::BorrowCountField: visitor(BorrowCount()); return true;
+    default: return false;
+    }
+}
+
+// 按字段比较两行；键相同时按行号升序，与稳定排序的结果一致
+template <typename F, bool Descending = false>
+class RowLess {
+public:
+    explicit RowLess(const CatalogColumns &columns) : key_(F::key(columns)) {}
+    bool operator()(int a, int b) const
+    {
+        const auto &ka = key_(a);
+        const auto &kb = key_(b);
+        if (ka < kb) return !Descending;
+        if (kb < ka) return Descending;
+        return a < b;
+    }
+
+private:
+    decltype(F::key(std::declval<const CatalogColumns &>())) key_;
+};
+
+// 数值/日期字段的闭区间谓词：lo <= 值 <= hi，日期字段上没有日期的行不入选
+template <typename F>
+class InRange {
+    static_assert(F::numeric, "InRange 只适用于数值和日期字段");
+
+public:
+    InRange(const CatalogColumns &columns, double lo, double hi) : key_(F::key(columns)), lo_(lo), hi_(hi) {}
+    bool operator()(int row) const
+    {
+        const auto value = key_(row);
+        if (F::dated && value == CatalogColumns::kNoDay) return false;
+        return value >= lo_ && value <= hi_;
+    }
+
+private:
+    decltype(F::key(std::declval<const CatalogColumns &>())) key_;
+    double lo_;
+    double hi_;
+};
+
+} // namespace BookFields
+
+// JSON 编解码：逐字段按描述实例化
+inline void toJson(QJsonObject &obj, const Book &b)
+{
+    BookFields::forEachField([&](auto field) {
+        typedef decltype(field) F;
+        obj[QLatin1String(F::jsonKey)] = F::toJson(F::get(b));
+    });
+}
+
+inline Book fromJson(const QJsonObject &obj)
+{
+    Book b;
+    BookFields::forEachField([&](auto field) {
+        typedef decltype(field) F;
+        F::set(b, F::fromJson(obj.value(QLatin1String(F::jsonKey))));
+    });
+    return b;
+}
+
+#endif // BOOKFIELDS_H
@@ -0,0 +1,212 @@
+#include "booktablemodel.h"
+
+#include "librarymanager.h"
+
+BookTableModel::BookTableModel(const LibraryManager *library, QObject *parent)
+    : QAbstractTableModel(parent)
+    , library_(library)
+{
+    connect(library_, &LibraryManager::bookAboutToBeInserted, this, &BookTableModel::onBookAboutToBeInserted);
+    connect(library_, &LibraryManager::bookInserted, this, &BookTableModel::onBookInserted);
+    connect(library_, &LibraryManager::bookChanged, this, &BookTableModel::onBookChanged);
+    connect(library_, &LibraryManager::bookAboutToBeRemoved, this, &BookTableModel::onBookAboutToBeRemoved);
+    connect(library_, &LibraryManager::bookRemoved, this, &BookTableModel::onBookRemoved);
+    connect(library_, &LibraryManager::catalogAboutToBeReset, this, &BookTableModel::onCatalogAboutToBeReset);
+    connect(library_, &LibraryManager::catalogReset, this, &BookTableModel::onCatalogReset);
+    connect(library_, &LibraryManager::bookMoved, this, &BookTableModel::onBookMoved);
+    connect(library_, &LibraryManager::sortOrderAboutToBeChanged, this, &BookTableModel::onSortOrderAboutToBeChanged);
+    connect(library_, &LibraryManager::sortOrderChanged, this, &BookTableModel::onSortOrderChanged);
+}
+
+int BookTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) return 0;
+    return showAll_ ? library_->count() : rows_.size();
+}
+
+int BookTableModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) return 0;
+    return ColumnCount;
+}
+
+QVariant BookTableModel::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole) return QVariant();
+    const int row = libraryRow(index.row());
+    if (row < 0) return QVariant();
+
+    // 每个单元格只读取对应的一列，不组装整本图书
+    const CatalogColumns &c = library_->columns();
+    switch (index.column()) {
+    case IndexIdColumn:     return c.indexId(row);
+    case NameColumn:        return c.name(row);
+    case LocationColumn:    return c.location(row);
+    case CategoryColumn:    return c.category(row);
+    case QuantityColumn:    return QString::number(c.quantity(row));
+    case PriceColumn:       return QString::number(c.price(row), 'f', 2);
+    case InDateColumn: {
+        const QDate d = c.inDate(row);
+        return d.isValid() ? d.toString(Qt::ISODate) : QString();
+    }
+    case ReturnDateColumn: {
+        const QDate d = c.returnDate(row);
+        return d.isValid() ? d.toString(Qt::ISODate) : QString();
+    }
+    case BorrowCountColumn: return QString::number(c.borrowCount(row));
+    case StatusColumn:      return c.available(row) ? QStringLiteral("✅ 可借") : QStringLiteral("❌ 不可借");
+    default:                return QVariant();
+    }
+}
+
+QVariant BookTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole) return QVariant();
+    if (orientation == Qt::Vertical) return section + 1;
+
+    switch (section) {
+    case IndexIdColumn:     return QStringLiteral("索引号");
+    case NameColumn:        return QStringLiteral("名称");
+    case LocationColumn:    return QStringLiteral("馆藏地址");
+    case CategoryColumn:    return QStringLiteral("类别");
+    case QuantityColumn:    return QStringLiteral("数量");
+    case PriceColumn:       return QStringLiteral("价格");
+    case InDateColumn:      return QStringLiteral("入库日期");
+    case ReturnDateColumn:  return QStringLiteral("归还日期");
+    case BorrowCountColumn: return QStringLiteral("借阅次数");
+    case StatusColumn:      return QStringLiteral("状态");
+    default:                return QVariant();
+    }
+}
+
+void BookTableModel::showAll()
+{
+    beginResetModel();
+    showAll_ = true;
+    rows_.clear();
+    endResetModel();
+}
+
+void BookTableModel::showView(const BookView &view)
+{
+    if (view.isAll() || !view.isCurrent()) {
+        showAll();
+        return;
+    }
+    showRows(view.rows());
+}
+
+void BookTableModel::showRows(const QVector<int> &rows)
+{
+    beginResetModel();
+    showAll_ = false;
+    rows_ = rows;
+    endResetModel();
+}
+
+bool BookTableModel::isShowingAll() const
+{
+    return showAll_;
+}
+
+int BookTableModel::viewRow(int libraryRow) const
+{
+    if (showAll_) return library_->displayPosition(libraryRow);
+    return rows_.indexOf(libraryRow);
+}
+
+void BookTableModel::onBookAboutToBeInserted(int row)
+{
+    // 查询结果视图不自动加入新书，只有"显示全部"时才插入对应行；
+    // 排序时新书的位置要等 LibraryManager 更新排列之后才知道，在 onBookInserted 中插入
+    if (showAll_ && !isSorted()) beginInsertRows(QModelIndex(), row, row);
+}
+
+void BookTableModel::onBookInserted(int row)
+{
+    if (showAll_ && isSorted()) {
+        const int vr = library_->displayPosition(row);
+        beginInsertRows(QModelIndex(), vr, vr);
+        endInsertRows();
+        return;
+    }
+    if (showAll_) {
+        endInsertRows();
+        return;
+    }
+    for (int &r : rows_) {
+        if (r >= row) ++r;
+    }
+}
+
+void BookTableModel::onBookMoved(int row, int fromPosition, int toPosition)
+{
+    Q_UNUSED(row);
+    // 查询结果视图保持查询给出的顺序，只有"显示全部"跟随显示顺序
+    if (!showAll_) return;
+    beginMoveRows(QModelIndex(), fromPosition, fromPosition, QModelIndex(),
+                  toPosition > fromPosition ? toPosition + 1 : toPosition);
+    endMoveRows();
+}
+
+void BookTableModel::onBookChanged(int row)
+{
+    const int vr = viewRow(row);
+    if (vr < 0) return;
+    emit dataChanged(index(vr, 0), index(vr, ColumnCount - 1));
+}
+
+void BookTableModel::onBookAboutToBeRemoved(int row)
+{
+    removingViewRow_ = viewRow(row);
+    if (removingViewRow_ >= 0) beginRemoveRows(QModelIndex(), removingViewRow_, removingViewRow_);
+}
+
+void BookTableModel::onBookRemoved(int row)
+{
+    if (!showAll_) {
+        if (removingViewRow_ >= 0) rows_.removeAt(removingViewRow_);
+        for (int &r : rows_) {
+            if (r > row) --r;
+        }
+    }
+    if (removingViewRow_ >= 0) endRemoveRows();
+    removingViewRow_ = -1;
+}
+
+void BookTableModel::onCatalogAboutToBeReset()
+{
+    beginResetModel();
+}
+
+void BookTableModel::onCatalogReset()
+{
+    // 整体替换后原查询结果的行号已失效，回到"显示全部"
+    showAll_ = true;
+    rows_.clear();
+    endResetModel();
+}
+
+void BookTableModel::onSortOrderAboutToBeChanged()
+{
+    // 查询结果视图保持查询给出的顺序，只有"显示全部"跟随显示顺序
+    resettingOrder_ = showAll_;
+    if (resettingOrder_) beginResetModel();
+}
+
+void BookTableModel::onSortOrderChanged()
+{
+    if (resettingOrder_) endResetModel();
+    resettingOrder_ = false;
+}
+
+bool BookTableModel::isSorted() const
+{
+    return !library_->sortOrder().isEmpty();
+}
+
+int BookTableModel::libraryRow(int row) const
+{
+    if (showAll_) return (row >= 0 && row < library_->count()) ? library_->displayRow(row) : -1;
+    return (row >= 0 && row < rows_.size()) ? rows_.at(row) : -1;
+}
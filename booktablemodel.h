@@ -0,0 +1,75 @@
+#ifndef BOOKTABLEMODEL_H
+#define BOOKTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QVector>
+
+#include "bookview.h"
+
+class LibraryManager;
+
+// 直接读取 LibraryManager 存储的表格模型：不复制图书，单元格文本在 data() 中按需生成
+class BookTableModel : public QAbstractTableModel {
+    Q_OBJECT
+public:
+    enum Column {
+        IndexIdColumn,
+        NameColumn,
+        LocationColumn,
+        CategoryColumn,
+        QuantityColumn,
+        PriceColumn,
+        InDateColumn,
+        ReturnDateColumn,
+        BorrowCountColumn,
+        StatusColumn,
+        ColumnCount
+    };
+
+    explicit BookTableModel(const LibraryManager *library, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    // 显示全部图书：按 LibraryManager 的当前显示顺序（见 setSortOrder），
+    // 视图行与行号的对应直接经 displayRow / displayPosition 查询，不复制排列
+    void showAll();
+    // 显示查询结果视图（见 bookview.h）：全部图书的视图等同于 showAll，其余只共享其行号；
+    // 视图已过期（目录版本变化）时回到显示全部
+    void showView(const BookView &view);
+    // 显示 LibraryManager 行号列表（例如索引查询的结果），不做任何查找
+    void showRows(const QVector<int> &rows);
+    bool isShowingAll() const;
+
+    // 视图行对应的 LibraryManager 行，越界返回 -1
+    int libraryRow(int row) const;
+
+    // LibraryManager 行对应的视图行，不在当前视图中返回 -1
+    int viewRow(int libraryRow) const;
+
+private slots:
+    void onBookAboutToBeInserted(int row);
+    void onBookInserted(int row);
+    void onBookChanged(int row);
+    void onBookAboutToBeRemoved(int row);
+    void onBookRemoved(int row);
+    void onCatalogAboutToBeReset();
+    void onCatalogReset();
+    void onBookMoved(int row, int fromPosition, int toPosition);
+    void onSortOrderAboutToBeChanged();
+    void onSortOrderChanged();
+
+private:
+    bool isSorted() const;
+
+private:
+    const LibraryManager *library_ = nullptr;
+    bool showAll_ = true;
+    QVector<int> rows_;   // 非"显示全部"时，视图行 -> LibraryManager 行
+    bool resettingOrder_ = false;   // sortOrderAboutToBeChanged 与 sortOrderChanged 之间正在重置
+    int removingViewRow_ = -1;   // beginRemoveRows 与 endRemoveRows 之间正在删除的视图行
+};
+
+#endif // BOOKTABLEMODEL_H
@@ -0,0 +1,89 @@
+#include "bookview.h"
+
+#include "librarymanager.h"
+
+#include <numeric>
+
+BookView BookView::all(const LibraryManager *library)
+{
+    BookView view;
+    view.library_ = library;
+    view.version_ = library->catalogVersion();
+    view.all_ = true;
+    view.size_ = library->count();
+    return view;
+}
+
+BookView BookView::fromRows(const LibraryManager *library, const QVector<int> &rows)
+{
+    BookView view;
+    view.library_ = library;
+    view.version_ = library->catalogVersion();
+    view.size_ = rows.size();
+    view.rows_ = rows;
+    return view;
+}
+
+const LibraryManager *BookView::library() const
+{
+    return library_;
+}
+
+quint64 BookView::version() const
+{
+    return version_;
+}
+
+bool BookView::isCurrent() const
+{
+    return library_ && library_->catalogVersion() == version_;
+}
+
+bool BookView::isAll() const
+{
+    return all_;
+}
+
+int BookView::size() const
+{
+    return size_;
+}
+
+bool BookView::isEmpty() const
+{
+    return size_ == 0;
+}
+
+int BookView::row(int i) const
+{
+    return all_ ? i : rows_.at(i);
+}
+
+Book BookView::book(int i) const
+{
+    return library_->bookAt(row(i));
+}
+
+BookView::const_iterator BookView::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+BookView::const_iterator BookView::end() const
+{
+    return const_iterator(this, size_);
+}
+
+QVector<int> BookView::rows() const
+{
+    if (!all_) return rows_;
+    QVector<int> result(size_);
+    std::iota(result.begin(), result.end(), 0);
+    return result;
+}
+
+QVector<Book> BookView::toBooks() const
+{
+    if (!library_) return QVector<Book>();
+    return all_ ? library_->columns().toBooks() : library_->columns().books(rows_);
+}
@@ -0,0 +1,62 @@
+#ifndef BOOKVIEW_H
+#define BOOKVIEW_H
+
+#include <QVector>
+
+#include "book.h"
+
+class LibraryManager;
+
+// 查询结果视图：只记录 LibraryManager 的行号，不复制图书
+//
+// "全部图书"视图不保存行号，构造没有任何分配；其他视图共享查询得到的行号数组。
+// 图书内容在 book() 中按需组装，或由调用方直接读取 LibraryManager::columns()。
+// 视图记下创建时的目录版本（见 LibraryManager::catalogVersion()）：
+// 之后发生增删或整体替换时行号可能已经错位，isCurrent() 返回 false，不应再按行号读取。
+class BookView {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const BookView *view, int pos) : view_(view), pos_(pos) {}
+        int operator*() const { return view_->row(pos_); }
+        const_iterator &operator++() { ++pos_; return *this; }
+        bool operator==(const const_iterator &other) const { return pos_ == other.pos_; }
+        bool operator!=(const const_iterator &other) const { return pos_ != other.pos_; }
+
+    private:
+        const BookView *view_;
+        int pos_;
+    };
+
+    BookView() = default;
+    static BookView all(const LibraryManager *library);
+    static BookView fromRows(const LibraryManager *library, const QVector<int> &rows);
+
+    const LibraryManager *library() const;
+    quint64 version() const;
+    bool isCurrent() const;
+    bool isAll() const;
+
+    int size() const;
+    bool isEmpty() const;
+    // 第 i 条结果在 LibraryManager 中的行号
+    int row(int i) const;
+    Book book(int i) const;
+
+    // 遍历得到的是行号
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // 需要独立的行号数组或图书副本时才调用；"全部图书"视图在这里才分配
+    QVector<int> rows() const;
+    QVector<Book> toBooks() const;
+
+private:
+    const LibraryManager *library_ = nullptr;
+    quint64 version_ = 0;
+    bool all_ = false;
+    int size_ = 0;
+    QVector<int> rows_;   // 非"全部图书"视图的行号
+};
+
+#endif // BOOKVIEW_H
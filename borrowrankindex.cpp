@@ -0,0 +1,71 @@
+#include "borrowrankindex.h"
+
+#include <algorithm>
+
+void BorrowRankIndex::clear()
+{
+    buckets_.clear();
+    rankedCount_ = 0;
+}
+
+void BorrowRankIndex::rebuild(const QVector<int> &borrowCounts)
+{
+    clear();
+    // 按行号顺序追加，每个桶天然有序
+    for (int i = 0; i < borrowCounts.size(); ++i) {
+        if (borrowCounts[i] <= 0) continue;
+        buckets_[borrowCounts[i]].append(i);
+        ++rankedCount_;
+    }
+}
+
+void BorrowRankIndex::insert(int borrowCount, int row)
+{
+    if (borrowCount <= 0) return;
+    QVector<int> &bucket = buckets_[borrowCount];
+    bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), row), row);
+    ++rankedCount_;
+}
+
+void BorrowRankIndex::remove(int borrowCount, int row)
+{
+    if (borrowCount <= 0) return;
+    auto it = buckets_.find(borrowCount);
+    if (it == buckets_.end()) return;
+    QVector<int> &bucket = it.value();
+    const auto pos = std::lower_bound(bucket.begin(), bucket.end(), row);
+    if (pos == bucket.end() || *pos != row) return;
+    bucket.erase(pos);
+    --rankedCount_;
+    if (bucket.isEmpty()) buckets_.erase(it);
+}
+
+void BorrowRankIndex::removeRow(int row)
+{
+    for (auto it = buckets_.begin(); it != buckets_.end(); ++it) {
+        QVector<int> &bucket = it.value();
+        for (auto p = std::upper_bound(bucket.begin(), bucket.end(), row); p != bucket.end(); ++p) {
+            --*p;
+        }
+    }
+}
+
+QVector<int> BorrowRankIndex::topRows(int limit) const
+{
+    QVector<int> result;
+    const int n = limit < 0 ? rankedCount_ : std::min(limit, rankedCount_);
+    result.reserve(n);
+    // 空桶会被立即删除，因此最多访问 K 个桶
+    for (auto it = buckets_.cend(); it != buckets_.cbegin() && result.size() < n;) {
+        --it;
+        const QVector<int> &bucket = it.value();
+        const int take = std::min<int>(bucket.size(), n - result.size());
+        for (int i = 0; i < take; ++i) result.append(bucket[i]);
+    }
+    return result;
+}
+
+int BorrowRankIndex::rankedCount() const
+{
+    return rankedCount_;
+}
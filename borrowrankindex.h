@@ -0,0 +1,33 @@
+#ifndef BORROWRANKINDEX_H
+#define BORROWRANKINDEX_H
+
+#include <QMap>
+#include <QVector>
+
+// 借阅次数排行索引：借阅次数 -> 升序行号列表
+//
+// 只收录借阅次数大于 0 的图书，借阅次数为 0 的大量新书不进入索引，
+// 借还时移动的只是一个小桶内的行号。取前 K 名从最高的桶开始向下遍历，
+// 不复制、不排序整个目录。
+class BorrowRankIndex {
+public:
+    void clear();
+    void rebuild(const QVector<int> &borrowCounts);
+
+    // borrowCount <= 0 时忽略
+    void insert(int borrowCount, int row);
+    void remove(int borrowCount, int row);
+    // 删除 row 之后，把所有大于 row 的行号减一
+    void removeRow(int row);
+
+    // 按借阅次数降序、同次数按行号升序的前 limit 行（limit < 0 表示全部已收录的行）
+    QVector<int> topRows(int limit) const;
+    // 已收录（借阅次数大于 0）的图书数
+    int rankedCount() const;
+
+private:
+    QMap<int, QVector<int>> buckets_;
+    int rankedCount_ = 0;
+};
+
+#endif // BORROWRANKINDEX_H
@@ -0,0 +1,267 @@
+#include "catalogcolumns.h"
+
+#include "chinesetext.h"
+
+#include <limits>
+
+const qint32 CatalogColumns::kNoDay = std::numeric_limits<qint32>::min();
+
+int CatalogColumns::size() const
+{
+    return size_;
+}
+
+void CatalogColumns::clear()
+{
+    *this = CatalogColumns();
+}
+
+void CatalogColumns::reserve(int size)
+{
+    indexIds_.reserve(size);
+    names_.reserve(size);
+    nameKeys_.reserve(size);
+    categoryCodes_.reserve(size);
+    locationCodes_.reserve(size);
+    quantities_.reserve(size);
+    prices_.reserve(size);
+    inDays_.reserve(size);
+    returnDays_.reserve(size);
+    borrowCounts_.reserve(size);
+    availableBits_.reserve((size + 63) / 64);
+}
+
+void CatalogColumns::append(const Book &book)
+{
+    indexIds_.append(book.indexId);
+    names_.append(book.name);
+    nameKeys_.append(ChineseText::sortKey(book.name));
+    categoryCodes_.append(categories_.intern(book.category));
+    locationCodes_.append(locations_.intern(book.location));
+    quantities_.append(book.quantity);
+    prices_.append(book.price);
+    inDays_.append(toDay(book.inDate));
+    returnDays_.append(toDay(book.returnDate));
+    borrowCounts_.append(book.borrowCount);
+    if (size_ % 64 == 0) availableBits_.append(0);
+    ++size_;
+    setAvailable(size_ - 1, book.available);
+}
+
+void CatalogColumns::set(int row, const Book &book)
+{
+    indexIds_[row] = book.indexId;
+    if (names_[row] != book.name) {
+        names_[row] = book.name;
+        nameKeys_[row] = ChineseText::sortKey(book.name);
+    }
+    categoryCodes_[row] = categories_.intern(book.category);
+    locationCodes_[row] = locations_.intern(book.location);
+    quantities_[row] = book.quantity;
+    prices_[row] = book.price;
+    inDays_[row] = toDay(book.inDate);
+    returnDays_[row] = toDay(book.returnDate);
+    borrowCounts_[row] = book.borrowCount;
+    setAvailable(row, book.available);
+}
+
+void CatalogColumns::removeAt(int row)
+{
+    indexIds_.removeAt(row);
+    names_.removeAt(row);
+    nameKeys_.removeAt(row);
+    categoryCodes_.removeAt(row);
+    locationCodes_.removeAt(row);
+    quantities_.removeAt(row);
+    prices_.removeAt(row);
+    inDays_.removeAt(row);
+    returnDays_.removeAt(row);
+    borrowCounts_.removeAt(row);
+
+    // 位图：row 所在字内高位右移一位，其后每个字右移一位并接上下一个字的最低位
+    const int word = row / 64;
+    const quint64 lowMask = (quint64(1) << (row % 64)) - 1;
+    quint64 *bits = availableBits_.data();
+    bits[word] = (bits[word] & lowMask) | ((bits[word] >> 1) & ~lowMask);
+    for (int i = word + 1; i < availableBits_.size(); ++i) {
+        bits[i - 1] |= (bits[i] & 1) << 63;
+        bits[i] >>= 1;
+    }
+    --size_;
+    if (size_ % 64 == 0) availableBits_.removeLast();
+}
+
+void CatalogColumns::setCirculation(int row, int quantity, int borrowCount, bool available, const QDate &returnDate)
+{
+    quantities_[row] = quantity;
+    borrowCounts_[row] = borrowCount;
+    returnDays_[row] = toDay(returnDate);
+    setAvailable(row, available);
+}
+
+Book CatalogColumns::book(int row) const
+{
+    Book b;
+    b.indexId = indexIds_[row];
+    b.name = names_[row];
+    b.location = location(row);
+    b.category = category(row);
+    b.quantity = quantities_[row];
+    b.price = prices_[row];
+    b.inDate = fromDay(inDays_[row]);
+    b.returnDate = fromDay(returnDays_[row]);
+    b.borrowCount = borrowCounts_[row];
+    b.available = available(row);
+    return b;
+}
+
+QVector<Book> CatalogColumns::books(const QVector<int> &rows) const
+{
+    QVector<Book> result;
+    result.reserve(rows.size());
+    for (int row : rows) result.append(book(row));
+    return result;
+}
+
+QVector<Book> CatalogColumns::toBooks() const
+{
+    QVector<Book> result;
+    result.reserve(size_);
+    for (int row = 0; row < size_; ++row) result.append(book(row));
+    return result;
+}
+
+const QString &CatalogColumns::indexId(int row) const
+{
+    return indexIds_[row];
+}
+
+const QString &CatalogColumns::name(int row) const
+{
+    return names_[row];
+}
+
+const QString &CatalogColumns::category(int row) const
+{
+    return categories_.valueOf(categoryCodes_[row]);
+}
+
+const QString &CatalogColumns::location(int row) const
+{
+    return locations_.valueOf(locationCodes_[row]);
+}
+
+int CatalogColumns::quantity(int row) const
+{
+    return quantities_[row];
+}
+
+double CatalogColumns::price(int row) const
+{
+    return prices_[row];
+}
+
+QDate CatalogColumns::inDate(int row) const
+{
+    return fromDay(inDays_[row]);
+}
+
+QDate CatalogColumns::returnDate(int row) const
+{
+    return fromDay(returnDays_[row]);
+}
+
+int CatalogColumns::borrowCount(int row) const
+{
+    return borrowCounts_[row];
+}
+
+bool CatalogColumns::available(int row) const
+{
+    return (availableBits_[row / 64] >> (row % 64)) & 1;
+}
+
+const QVector<QString> &CatalogColumns::indexIds() const
+{
+    return indexIds_;
+}
+
+const QVector<QString> &CatalogColumns::names() const
+{
+    return names_;
+}
+
+const QVector<QByteArray> &CatalogColumns::nameKeys() const
+{
+    return nameKeys_;
+}
+
+const QVector<int> &CatalogColumns::categoryCodes() const
+{
+    return categoryCodes_;
+}
+
+const QVector<int> &CatalogColumns::locationCodes() const
+{
+    return locationCodes_;
+}
+
+const QVector<int> &CatalogColumns::quantities() const
+{
+    return quantities_;
+}
+
+const QVector<double> &CatalogColumns::prices() const
+{
+    return prices_;
+}
+
+const QVector<qint32> &CatalogColumns::inDays() const
+{
+    return inDays_;
+}
+
+const QVector<qint32> &CatalogColumns::returnDays() const
+{
+    return returnDays_;
+}
+
+const QVector<int> &CatalogColumns::borrowCounts() const
+{
+    return borrowCounts_;
+}
+
+const QVector<quint64> &CatalogColumns::availableBits() const
+{
+    return availableBits_;
+}
+
+const StringDictionary &CatalogColumns::categoryDictionary() const
+{
+    return categories_;
+}
+
+const StringDictionary &CatalogColumns::locationDictionary() const
+{
+    return locations_;
+}
+
+qint32 CatalogColumns::toDay(const QDate &date)
+{
+    return date.isValid() ? qint32(date.toJulianDay()) : kNoDay;
+}
+
+QDate CatalogColumns::fromDay(qint32 day)
+{
+    return day == kNoDay ? QDate() : QDate::fromJulianDay(day);
+}
+
+void CatalogColumns::setAvailable(int row, bool available)
+{
+    const quint64 mask = quint64(1) << (row % 64);
+    if (available) {
+        availableBits_[row / 64] |= mask;
+    } else {
+        availableBits_[row / 64] &= ~mask;
+    }
+}
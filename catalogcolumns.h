@@ -0,0 +1,88 @@
+#ifndef CATALOGCOLUMNS_H
+#define CATALOGCOLUMNS_H
+
+#include <QByteArray>
+#include <QVector>
+#include <QString>
+#include <QDate>
+
+#include "book.h"
+#include "stringdictionary.h"
+
+// 按列存储的图书目录（结构数组）
+//
+// 每个字段一个连续数组：数值字段直接存值，日期存儒略日（无效日期为 kNoDay），
+// 分类/馆藏地址存字典编码，可借状态为位图，书名另存一列写入时生成的排序键。
+// 只看一个字段的筛选和统计是单列上的紧凑循环，不必把整条记录读进缓存。
+// 需要完整图书时用 book() 按行组装；所有列都是隐式共享的，复制整个对象只增加引用计数。
+class CatalogColumns {
+public:
+    static const qint32 kNoDay;
+
+    int size() const;
+    void clear();
+    void reserve(int size);
+
+    void append(const Book &book);
+    void set(int row, const Book &book);
+    void removeAt(int row);
+    // 借还只改动这几列
+    void setCirculation(int row, int quantity, int borrowCount, bool available, const QDate &returnDate);
+
+    Book book(int row) const;
+    QVector<Book> books(const QVector<int> &rows) const;
+    QVector<Book> toBooks() const;
+
+    const QString &indexId(int row) const;
+    const QString &name(int row) const;
+    const QString &category(int row) const;
+    const QString &location(int row) const;
+    int quantity(int row) const;
+    double price(int row) const;
+    QDate inDate(int row) const;
+    QDate returnDate(int row) const;
+    int borrowCount(int row) const;
+    bool available(int row) const;
+
+    // 整列访问，供筛选、统计和索引重建直接遍历
+    const QVector<QString> &indexIds() const;
+    const QVector<QString> &names() const;
+    // 书名的排序键（见 ChineseText::sortKey），按字节比较即为按拼音的书名顺序
+    const QVector<QByteArray> &nameKeys() const;
+    const QVector<int> &categoryCodes() const;
+    const QVector<int> &locationCodes() const;
+    const QVector<int> &quantities() const;
+    const QVector<double> &prices() const;
+    const QVector<qint32> &inDays() const;
+    const QVector<qint32> &returnDays() const;
+    const QVector<int> &borrowCounts() const;
+    // 第 row 行的可借状态为第 row / 64 个字的第 row % 64 位
+    const QVector<quint64> &availableBits() const;
+
+    const StringDictionary &categoryDictionary() const;
+    const StringDictionary &locationDictionary() const;
+
+    static qint32 toDay(const QDate &date);
+    static QDate fromDay(qint32 day);
+
+private:
+    void setAvailable(int row, bool available);
+
+private:
+    int size_ = 0;
+    QVector<QString> indexIds_;
+    QVector<QString> names_;
+    QVector<QByteArray> nameKeys_;
+    QVector<int> categoryCodes_;
+    QVector<int> locationCodes_;
+    QVector<int> quantities_;
+    QVector<double> prices_;
+    QVector<qint32> inDays_;
+    QVector<qint32> returnDays_;
+    QVector<int> borrowCounts_;
+    QVector<quint64> availableBits_;
+    StringDictionary categories_;
+    StringDictionary locations_;
+};
+
+#endif // CATALOGCOLUMNS_H
@@ -0,0 +1,196 @@
+#include "catalogquery.h"
+
+#include <limits>
+
+struct QueryPredicate::Node {
+    Kind kind = MatchAll;
+    Field field = NameField;
+    QString text;
+    double lower = 0.0;
+    double upper = 0.0;
+    QVector<QueryPredicate> children;
+};
+
+QueryPredicate::QueryPredicate()
+    : d_(new Node)
+{
+}
+
+QueryPredicate::QueryPredicate(Node *node)
+    : d_(node)
+{
+}
+
+QueryPredicate QueryPredicate::equals(Field field, const QString &value)
+{
+    Node *node = new Node;
+    node->kind = Equals;
+    node->field = field;
+    node->text = value;
+    return QueryPredicate(node);
+}
+
+QueryPredicate QueryPredicate::contains(Field field, const QString &value)
+{
+    Node *node = new Node;
+    node->kind = Contains;
+    node->field = field;
+    node->text = value;
+    return QueryPredicate(node);
+}
+
+QueryPredicate QueryPredicate::between(Field field, double lo, double hi)
+{
+    Node *node = new Node;
+    node->kind = Between;
+    node->field = field;
+    node->lower = lo;
+    node->upper = hi;
+    return QueryPredicate(node);
+}
+
+QueryPredicate QueryPredicate::between(Field field, const QDate &first, const QDate &last)
+{
+    // 儒略日在 double 中可以精确表示
+    const double inf = std::numeric_limits<double>::infinity();
+    return between(field, first.isValid() ? double(first.toJulianDay()) : -inf,
+                   last.isValid() ? double(last.toJulianDay()) : inf);
+}
+
+QueryPredicate QueryPredicate::available()
+{
+    Node *node = new Node;
+    node->kind = Available;
+    return QueryPredicate(node);
+}
+
+QueryPredicate QueryPredicate::borrowed()
+{
+    Node *node = new Node;
+    node->kind = Borrowed;
+    return QueryPredicate(node);
+}
+
+QueryPredicate::Kind QueryPredicate::kind() const
+{
+    return d_->kind;
+}
+
+QueryPredicate::Field QueryPredicate::field() const
+{
+    return d_->field;
+}
+
+const QString &QueryPredicate::text() const
+{
+    return d_->text;
+}
+
+double QueryPredicate::lower() const
+{
+    return d_->lower;
+}
+
+double QueryPredicate::upper() const
+{
+    return d_->upper;
+}
+
+const QVector<QueryPredicate> &QueryPredicate::children() const
+{
+    return d_->children;
+}
+
+QueryPredicate QueryPredicate::combine(Kind kind, const QueryPredicate &a, const QueryPredicate &b)
+{
+    // 同类节点展开为一层，a && b && c 只有一个 And 节点，规划时可在全部条件中挑选
+    Node *node = new Node;
+    node->kind = kind;
+    for (const QueryPredicate *p : { &a, &b }) {
+        if (p->kind() == kind) {
+            node->children += p->children();
+        } else {
+            node->children.append(*p);
+        }
+    }
+    return QueryPredicate(node);
+}
+
+QueryPredicate operator&&(const QueryPredicate &a, const QueryPredicate &b)
+{
+    if (a.kind() == QueryPredicate::MatchAll) return b;
+    if (b.kind() == QueryPredicate::MatchAll) return a;
+    return QueryPredicate::combine(QueryPredicate::And, a, b);
+}
+
+QueryPredicate operator||(const QueryPredicate &a, const QueryPredicate &b)
+{
+    if (a.kind() == QueryPredicate::MatchAll) return a;
+    if (b.kind() == QueryPredicate::MatchAll) return b;
+    return QueryPredicate::combine(QueryPredicate::Or, a, b);
+}
+
+QueryPredicate operator!(const QueryPredicate &a)
+{
+    if (a.kind() == QueryPredicate::Not) return a.children().first();
+    QueryPredicate::Node *node = new QueryPredicate::Node;
+    node->kind = QueryPredicate::Not;
+    node->children.append(a);
+    return QueryPredicate(node);
+}
+
+CatalogQuery::CatalogQuery(const QueryPredicate &predicate)
+    : predicate_(predicate)
+{
+}
+
+CatalogQuery &CatalogQuery::where(const QueryPredicate &predicate)
+{
+    predicate_ = predicate;
+    return *this;
+}
+
+CatalogQuery &CatalogQuery::orderBy(QueryPredicate::Field field, Qt::SortOrder order)
+{
+    ordered_ = field != QueryPredicate::AnyTextField;
+    sortField_ = field;
+    sortOrder_ = order;
+    return *this;
+}
+
+CatalogQuery &CatalogQuery::limit(int count, int offset)
+{
+    limit_ = count;
+    offset_ = qMax(0, offset);
+    return *this;
+}
+
+const QueryPredicate &CatalogQuery::predicate() const
+{
+    return predicate_;
+}
+
+bool CatalogQuery::isOrdered() const
+{
+    return ordered_;
+}
+
+QueryPredicate::Field CatalogQuery::sortField() const
+{
+    return sortField_;
+}
+
+Qt::SortOrder CatalogQuery::sortOrder() const
+{
+    return sortOrder_;
+}
+
+int CatalogQuery::limitCount() const
+{
+    return limit_;
+}
+
+int CatalogQuery::offset() const
+{
+    return offset_;
+}
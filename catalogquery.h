@@ -0,0 +1,107 @@
+#ifndef CATALOGQUERY_H
+#define CATALOGQUERY_H
+
+#include <QDate>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+// 查询谓词树：叶子是单个字段上的条件，内部节点是与/或/非
+//
+// 谓词是不可变的值类型，节点隐式共享，组合时不复制子树。
+// 用 && / || / ! 组合，例如
+//   QueryPredicate::contains(QueryPredicate::CategoryField, "计算机科学")
+//       && QueryPredicate::equals(QueryPredicate::LocationField, "仙林")
+//       && QueryPredicate::between(QueryPredicate::PriceField, 0, 60)
+//       && QueryPredicate::available()
+// 执行见 queryplanner.h。
+class QueryPredicate {
+public:
+    enum Field {
+        NameField,
+        IndexIdField,
+        CategoryField,
+        LocationField,
+        QuantityField,
+        PriceField,
+        InDateField,
+        ReturnDateField,
+        BorrowCountField,
+        AnyTextField        // 名称、索引号、分类、馆藏地址中任一个，仅用于 contains
+    };
+    enum Kind {
+        MatchAll,
+        Equals,             // 文本字段完全相同
+        Contains,           // 文本字段包含子串
+        Between,            // 数值/日期字段在闭区间内
+        Available,          // 可借且有库存
+        Borrowed,           // 已借出或无库存
+        And,
+        Or,
+        Not
+    };
+
+    // 默认构造的谓词匹配全部图书
+    QueryPredicate();
+
+    // 分类/馆藏地址/索引号区分大小写完全相同；名称按归一化后（见 chinesetext.h）相同
+    static QueryPredicate equals(Field field, const QString &value);
+    // 名称/索引号/AnyTextField 按归一化后的子串匹配（与 searchBooks 一致），
+    // 分类/馆藏地址不区分大小写（与 getByCategory/getByLocation 一致）
+    static QueryPredicate contains(Field field, const QString &value);
+    // 数值字段 lo <= 值 <= hi，可用 ±infinity 表示单侧区间
+    static QueryPredicate between(Field field, double lo, double hi);
+    // 日期字段 first <= 日期 <= last，无效的 QDate 表示该侧不限；没有日期的图书不入选
+    static QueryPredicate between(Field field, const QDate &first, const QDate &last);
+    static QueryPredicate available();
+    static QueryPredicate borrowed();
+
+    Kind kind() const;
+    Field field() const;
+    const QString &text() const;
+    double lower() const;
+    double upper() const;
+    // And/Or 的各个条件，Not 的唯一条件
+    const QVector<QueryPredicate> &children() const;
+
+    friend QueryPredicate operator&&(const QueryPredicate &a, const QueryPredicate &b);
+    friend QueryPredicate operator||(const QueryPredicate &a, const QueryPredicate &b);
+    friend QueryPredicate operator!(const QueryPredicate &a);
+
+private:
+    struct Node;
+    explicit QueryPredicate(Node *node);
+    static QueryPredicate combine(Kind kind, const QueryPredicate &a, const QueryPredicate &b);
+
+    QSharedPointer<const Node> d_;
+};
+
+// 一次完整的查询：谓词 + 可选的排序 + 分页
+class CatalogQuery {
+public:
+    CatalogQuery() = default;
+    explicit CatalogQuery(const QueryPredicate &predicate);
+
+    CatalogQuery &where(const QueryPredicate &predicate);
+    // 排序键相同的图书按行号升序；不指定时结果按行号升序
+    CatalogQuery &orderBy(QueryPredicate::Field field, Qt::SortOrder order = Qt::AscendingOrder);
+    // 第 offset 条起最多 count 条，count < 0 表示不限
+    CatalogQuery &limit(int count, int offset = 0);
+
+    const QueryPredicate &predicate() const;
+    bool isOrdered() const;
+    QueryPredicate::Field sortField() const;
+    Qt::SortOrder sortOrder() const;
+    int limitCount() const;
+    int offset() const;
+
+private:
+    QueryPredicate predicate_;
+    bool ordered_ = false;
+    QueryPredicate::Field sortField_ = QueryPredicate::NameField;
+    Qt::SortOrder sortOrder_ = Qt::AscendingOrder;
+    int limit_ = -1;
+    int offset_ = 0;
+};
+
+#endif // CATALOGQUERY_H
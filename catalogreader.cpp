@@ -0,0 +1,356 @@
+#include "catalogreader.h"
+
+#include <QIODevice>
+#include <QDate>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+
+const int kChunkSize = 64 * 1024;
+const int kMaxDepth = 512;
+
+void appendUtf8(QByteArray *out, uint cp)
+{
+    if (cp < 0x80) {
+        out->append(char(cp));
+    } else if (cp < 0x800) {
+        out->append(char(0xC0 | (cp >> 6)));
+        out->append(char(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out->append(char(0xE0 | (cp >> 12)));
+        out->append(char(0x80 | ((cp >> 6) & 0x3F)));
+        out->append(char(0x80 | (cp & 0x3F)));
+    } else {
+        out->append(char(0xF0 | (cp >> 18)));
+        out->append(char(0x80 | ((cp >> 12) & 0x3F)));
+        out->append(char(0x80 | ((cp >> 6) & 0x3F)));
+        out->append(char(0x80 | (cp & 0x3F)));
+    }
+}
+
+// 与 QJsonValue::toInt 一致：只有整数值的数字才被接受
+int toInt(double d, int defaultValue)
+{
+    if (!std::isfinite(d) || d != std::floor(d)
+        || d < double(std::numeric_limits<int>::min())
+        || d > double(std::numeric_limits<int>::max())) {
+        return defaultValue;
+    }
+    return int(d);
+}
+
+} // namespace
+
+CatalogJsonReader::CatalogJsonReader(QIODevice *device)
+    : device_(device)
+{
+}
+
+bool CatalogJsonReader::hasError() const
+{
+    return state_ == Failed;
+}
+
+QString CatalogJsonReader::errorString() const
+{
+    return error_;
+}
+
+qint64 CatalogJsonReader::bytesConsumed() const
+{
+    return bufferOffset_ + pos_;
+}
+
+bool CatalogJsonReader::fail(const QString &message)
+{
+    if (state_ != Failed) {
+        state_ = Failed;
+        error_ = QStringLiteral("%1 (偏移 %2)").arg(message).arg(bytesConsumed());
+    }
+    return false;
+}
+
+bool CatalogJsonReader::fill()
+{
+    if (pos_ < buffer_.size()) return true;
+    bufferOffset_ += buffer_.size();
+    buffer_.resize(kChunkSize);
+    const qint64 n = device_->read(buffer_.data(), kChunkSize);
+    buffer_.resize(n > 0 ? int(n) : 0);
+    pos_ = 0;
+    return !buffer_.isEmpty();
+}
+
+int CatalogJsonReader::peekRaw()
+{
+    if (!fill()) return -1;
+    return uchar(buffer_.at(pos_));
+}
+
+int CatalogJsonReader::getRaw()
+{
+    const int c = peekRaw();
+    if (c >= 0) ++pos_;
+    return c;
+}
+
+int CatalogJsonReader::peek()
+{
+    for (;;) {
+        const int c = peekRaw();
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') return c;
+        ++pos_;
+    }
+}
+
+int CatalogJsonReader::get()
+{
+    const int c = peek();
+    if (c >= 0) ++pos_;
+    return c;
+}
+
+bool CatalogJsonReader::expect(char c)
+{
+    if (get() != uchar(c)) return fail(QStringLiteral("缺少 '%1'").arg(QLatin1Char(c)));
+    return true;
+}
+
+// 读取字符串内容（起始引号已消费），结果为 UTF-8 字节
+bool CatalogJsonReader::readStringBody(QByteArray *utf8)
+{
+    utf8->clear();
+    for (;;) {
+        if (!fill()) return fail(QStringLiteral("字符串未结束"));
+        const char *begin = buffer_.constData() + pos_;
+        const char *end = buffer_.constData() + buffer_.size();
+        const char *p = begin;
+        while (p < end && *p != '"' && *p != '\\' && uchar(*p) >= 0x20) ++p;
+        utf8->append(begin, int(p - begin));
+        pos_ += int(p - begin);
+        if (p == end) continue;
+
+        const char c = *p;
+        ++pos_;
+        if (c == '"') return true;
+        if (c != '\\') return fail(QStringLiteral("字符串中含有控制字符"));
+
+        const int e = getRaw();
+        switch (e) {
+        case '"':  utf8->append('"'); break;
+        case '\\': utf8->append('\\'); break;
+        case '/':  utf8->append('/'); break;
+        case 'b':  utf8->append('\b'); break;
+        case 'f':  utf8->append('\f'); break;
+        case 'n':  utf8->append('\n'); break;
+        case 'r':  utf8->append('\r'); break;
+        case 't':  utf8->append('\t'); break;
+        case 'u': {
+            uint cp = 0;
+            if (!readHex4(&cp)) return false;
+            if (cp >= 0xD800 && cp < 0xDC00) {
+                // 代理对：高位后必须紧跟 \uDC00-\uDFFF
+                uint low = 0;
+                if (getRaw() != '\\' || getRaw() != 'u' || !readHex4(&low)) {
+                    return fail(QStringLiteral("无效的 UTF-16 代理对"));
+                }
+                cp = (low >= 0xDC00 && low < 0xE000)
+                        ? 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00)
+                        : 0xFFFD;
+            } else if (cp >= 0xDC00 && cp < 0xE000) {
+                cp = 0xFFFD;
+            }
+            appendUtf8(utf8, cp);
+            break;
+        }
+        default:
+            return fail(QStringLiteral("无效的转义字符"));
+        }
+    }
+}
+
+bool CatalogJsonReader::readHex4(uint *codeUnit)
+{
+    uint v = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int c = getRaw();
+        v <<= 4;
+        if (c >= '0' && c <= '9') v |= uint(c - '0');
+        else if (c >= 'a' && c <= 'f') v |= uint(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') v |= uint(c - 'A' + 10);
+        else return fail(QStringLiteral("无效的 \\u 转义"));
+    }
+    *codeUnit = v;
+    return true;
+}
+
+bool CatalogJsonReader::readNumber(double *out)
+{
+    char text[64];
+    int len = 0;
+    for (;;) {
+        const int c = peekRaw();
+        if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) break;
+        if (len == int(sizeof(text)) - 1) return fail(QStringLiteral("数字过长"));
+        text[len++] = char(c);
+        ++pos_;
+    }
+    text[len] = '\0';
+    bool ok = false;
+    *out = QByteArray::fromRawData(text, len).toDouble(&ok);
+    if (len == 0 || !ok) return fail(QStringLiteral("无效的数字"));
+    return true;
+}
+
+bool CatalogJsonReader::readLiteral(const char *word)
+{
+    for (const char *p = word; *p; ++p) {
+        if (getRaw() != uchar(*p)) return fail(QStringLiteral("无效的字面量"));
+    }
+    return true;
+}
+
+// 读取一个字段值；对象与数组整体跳过，记为 Other
+bool CatalogJsonReader::readValue(Value *value)
+{
+    const int c = peek();
+    switch (c) {
+    case '"':
+        ++pos_;
+        value->type = Value::String;
+        return readStringBody(&value->utf8);
+    case 't':
+        value->type = Value::Bool;
+        value->boolean = true;
+        return readLiteral("true");
+    case 'f':
+        value->type = Value::Bool;
+        value->boolean = false;
+        return readLiteral("false");
+    case 'n':
+        value->type = Value::Null;
+        return readLiteral("null");
+    case '{':
+    case '[':
+        value->type = Value::Other;
+        return skipValue(0);
+    default:
+        value->type = Value::Number;
+        return readNumber(&value->number);
+    }
+}
+
+bool CatalogJsonReader::skipValue(int depth)
+{
+    if (depth > kMaxDepth) return fail(QStringLiteral("嵌套层数过深"));
+    const int c = peek();
+    if (c == '{' || c == '[') {
+        const char close = c == '{' ? '}' : ']';
+        ++pos_;
+        if (peek() == uchar(close)) {
+            ++pos_;
+            return true;
+        }
+        for (;;) {
+            if (c == '{') {
+                if (get() != '"' || !readStringBody(&skippedKey_) || !expect(':')) {
+                    return fail(QStringLiteral("无效的对象键"));
+                }
+            }
+            if (!skipValue(depth + 1)) return false;
+            const int next = get();
+            if (next == uchar(close)) return true;
+            if (next != ',') return fail(QStringLiteral("缺少 ',' 或 '%1'").arg(QLatin1Char(close)));
+        }
+    }
+    Value ignored;
+    return readValue(&ignored);
+}
+
+// 读取一个图书对象（起始 '{' 已消费）
+bool CatalogJsonReader::readBook(Book *book)
+{
+    Book b;
+    if (peek() == '}') {
+        ++pos_;
+        *book = std::move(b);
+        return true;
+    }
+    for (;;) {
+        if (get() != '"' || !readStringBody(&key_)) return fail(QStringLiteral("无效的对象键"));
+        if (!expect(':') || !readValue(&value_)) return false;
+
+        const Value &v = value_;
+        const QString text = v.type == Value::String ? QString::fromUtf8(v.utf8) : QString();
+        const double number = v.type == Value::Number ? v.number : 0.0;
+        if (key_ == "indexId") {
+            b.indexId = text;
+        } else if (key_ == "name") {
+            b.name = text;
+        } else if (key_ == "location") {
+            b.location = text;
+        } else if (key_ == "category") {
+            b.category = text;
+        } else if (key_ == "quantity") {
+            b.quantity = v.type == Value::Number ? toInt(number, 0) : 0;
+        } else if (key_ == "price") {
+            b.price = number;
+        } else if (key_ == "inDate") {
+            b.inDate = QDate::fromString(text, Qt::ISODate);
+        } else if (key_ == "returnDate") {
+            b.returnDate = text.isEmpty() ? QDate() : QDate::fromString(text, Qt::ISODate);
+        } else if (key_ == "borrowCount") {
+            b.borrowCount = v.type == Value::Number ? toInt(number, 0) : 0;
+        } else if (key_ == "available") {
+            b.available = v.type == Value::Bool ? v.boolean : true;
+        }
+
+        const int next = get();
+        if (next == '}') break;
+        if (next != ',') return fail(QStringLiteral("缺少 ',' 或 '}'"));
+    }
+    *book = std::move(b);
+    return true;
+}
+
+bool CatalogJsonReader::readNext(Book *book)
+{
+    if (state_ == Start) {
+        // 跳过 UTF-8 BOM
+        if (peekRaw() == 0xEF) {
+            if (getRaw() != 0xEF || getRaw() != 0xBB || getRaw() != 0xBF) return fail(QStringLiteral("无效的文件头"));
+        }
+        if (get() != '[') return fail(QStringLiteral("顶层不是数组"));
+        if (peek() == ']') {
+            ++pos_;
+            state_ = Finished;
+            if (peek() != -1) return fail(QStringLiteral("数组之后存在多余内容"));
+            return false;
+        }
+        state_ = InArray;
+    }
+
+    while (state_ == InArray) {
+        bool gotBook = false;
+        if (peek() == '{') {
+            ++pos_;
+            if (!readBook(book)) return false;
+            gotBook = true;
+        } else if (!skipValue(0)) {
+            // 与原实现一致，非对象元素直接忽略
+            return false;
+        }
+
+        const int next = get();
+        if (next == ']') {
+            state_ = Finished;
+            if (peek() != -1) return fail(QStringLiteral("数组之后存在多余内容"));
+        } else if (next != ',') {
+            return fail(QStringLiteral("缺少 ',' 或 ']'"));
+        }
+        if (gotBook) return true;
+    }
+    return false;
+}
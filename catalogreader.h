@@ -0,0 +1,66 @@
+#ifndef CATALOGREADER_H
+#define CATALOGREADER_H
+
+#include <QByteArray>
+#include <QString>
+
+#include "book.h"
+
+class QIODevice;
+
+// 流式读取 JSON 图书目录（顶层为对象数组）
+// 以固定大小的缓冲区逐段读取文件，逐条解析数组元素并直接填充 Book，
+// 不构建 QJsonDocument/QJsonObject，内存占用与文件大小无关。
+// 字段的取值规则与 bookfields.h 中的 fromJson 保持一致。
+class CatalogJsonReader {
+public:
+    explicit CatalogJsonReader(QIODevice *device);
+
+    // 读取下一本图书；到达数组末尾或出错时返回 false，出错可通过 hasError 判断
+    bool readNext(Book *book);
+
+    bool hasError() const;
+    QString errorString() const;
+    // 已解析的字节数，用于报告加载进度
+    qint64 bytesConsumed() const;
+
+private:
+    struct Value {
+        enum Type { Null, Bool, Number, String, Other };
+        Type type = Null;
+        bool boolean = false;
+        double number = 0.0;
+        QByteArray utf8;
+    };
+
+    bool fill();
+    int peekRaw();
+    int getRaw();
+    int peek();
+    int get();
+    bool expect(char c);
+
+    bool readStringBody(QByteArray *utf8);
+    bool readHex4(uint *codeUnit);
+    bool readNumber(double *out);
+    bool readLiteral(const char *word);
+    bool readValue(Value *value);
+    bool skipValue(int depth);
+    bool readBook(Book *book);
+    bool fail(const QString &message);
+
+private:
+    enum State { Start, InArray, Finished, Failed };
+
+    QIODevice *device_ = nullptr;
+    QByteArray buffer_;
+    int pos_ = 0;
+    qint64 bufferOffset_ = 0;   // buffer_ 起始位置在文件中的偏移
+    State state_ = Start;
+    QString error_;
+    QByteArray key_;
+    QByteArray skippedKey_;   // 跳过嵌套对象时使用，避免覆盖当前字段名
+    Value value_;
+};
+
+#endif // CATALOGREADER_H
@@ -0,0 +1,319 @@
+#include "catalogsnapshot.h"
+#include "checksum.h"
+
+#include <QHash>
+#include <QPair>
+#include <QSaveFile>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+const char kMagic[8] = { 'N', 'J', 'L', 'I', 'B', 'S', 'N', 'P' };
+const quint32 kVersion = 1;
+const int kHeaderSize = 64;
+const int kRecordSize = 64;
+
+// 文件头字段偏移
+enum HeaderOffset {
+    HeaderMagic = 0,
+    HeaderVersion = 8,
+    HeaderSizeField = 12,
+    HeaderRecordSize = 16,
+    HeaderRecordCount = 20,
+    HeaderHeapSize = 24,
+    HeaderRecordsCrc = 32,
+    HeaderIndexCrc = 36,
+    HeaderHeapCrc = 40,
+    HeaderJournalSequence = 48,   // 快照包含的最后一条日志序号（见 circulationjournal.h）
+    HeaderCrc = 60          // 覆盖 [0, 60) 字节
+};
+
+// 记录字段偏移；字符串字段为 (quint32 偏移, quint32 长度)
+enum RecordOffset {
+    RecordIndexId = 0,
+    RecordName = 8,
+    RecordLocation = 16,
+    RecordCategory = 24,
+    RecordPrice = 32,       // double 的 IEEE-754 位模式
+    RecordQuantity = 40,
+    RecordBorrowCount = 44,
+    RecordInDate = 48,      // 儒略日，无效日期为 kNoDate
+    RecordReturnDate = 52,
+    RecordFlags = 56
+};
+
+const qint32 kNoDate = std::numeric_limits<qint32>::min();
+const quint32 kFlagAvailable = 0x1;
+
+quint64 align8(quint64 v)
+{
+    return (v + 7) & ~quint64(7);
+}
+
+qint32 encodeDate(const QDate &d)
+{
+    return d.isValid() ? qint32(d.toJulianDay()) : kNoDate;
+}
+
+QDate decodeDate(qint32 jd)
+{
+    return jd == kNoDate ? QDate() : QDate::fromJulianDay(jd);
+}
+
+double decodeDouble(const uchar *p)
+{
+    const quint64 bits = qFromLittleEndian<quint64>(p);
+    double d;
+    std::memcpy(&d, &bits, sizeof d);
+    return d;
+}
+
+void encodeDouble(double d, uchar *p)
+{
+    quint64 bits;
+    std::memcpy(&bits, &d, sizeof bits);
+    qToLittleEndian<quint64>(bits, p);
+}
+
+int compareBytes(const char *a, int alen, const char *b, int blen)
+{
+    const int r = std::memcmp(a, b, size_t(qMin(alen, blen)));
+    if (r != 0) return r;
+    return alen < blen ? -1 : (alen > blen ? 1 : 0);
+}
+
+bool setError(QString *errorMessage, const QString &message)
+{
+    if (errorMessage) *errorMessage = message;
+    return false;
+}
+
+} // namespace
+
+CatalogSnapshot::CatalogSnapshot()
+{
+}
+
+CatalogSnapshot::~CatalogSnapshot()
+{
+    close();
+}
+
+bool CatalogSnapshot::open(const QString &filePath, QString *errorMessage, bool verifyChecksums)
+{
+    close();
+    file_.setFileName(filePath);
+    if (!file_.open(QIODevice::ReadOnly)) {
+        return setError(errorMessage, QStringLiteral("无法打开文件: ") + filePath);
+    }
+    size_ = file_.size();
+    if (size_ < kHeaderSize) {
+        close();
+        return setError(errorMessage, QStringLiteral("快照文件不完整"));
+    }
+    data_ = file_.map(0, size_);
+    if (!data_) {
+        close();
+        return setError(errorMessage, QStringLiteral("无法映射文件: ") + filePath);
+    }
+
+    const uchar *h = data_;
+    if (std::memcmp(h + HeaderMagic, kMagic, sizeof kMagic) != 0) {
+        close();
+        return setError(errorMessage, QStringLiteral("不是图书快照文件"));
+    }
+    if (qFromLittleEndian<quint32>(h + HeaderCrc) != crc32(h, HeaderCrc)) {
+        close();
+        return setError(errorMessage, QStringLiteral("快照文件头校验失败"));
+    }
+    if (qFromLittleEndian<quint32>(h + HeaderVersion) != kVersion
+        || qFromLittleEndian<quint32>(h + HeaderSizeField) != quint32(kHeaderSize)
+        || qFromLittleEndian<quint32>(h + HeaderRecordSize) != quint32(kRecordSize)) {
+        close();
+        return setError(errorMessage, QStringLiteral("不支持的快照版本"));
+    }
+
+    const quint32 count = qFromLittleEndian<quint32>(h + HeaderRecordCount);
+    const quint64 heapSize = qFromLittleEndian<quint64>(h + HeaderHeapSize);
+    const quint64 recordsBytes = quint64(count) * kRecordSize;
+    const quint64 indexOffset = kHeaderSize + recordsBytes;
+    const quint64 heapOffset = align8(indexOffset + quint64(count) * 4);
+    if (count > quint32(std::numeric_limits<int>::max()) || heapOffset + heapSize > quint64(size_)) {
+        close();
+        return setError(errorMessage, QStringLiteral("快照文件不完整"));
+    }
+
+    records_ = data_ + kHeaderSize;
+    heap_ = data_ + heapOffset;
+    heapSize_ = heapSize;
+    journalSequence_ = qFromLittleEndian<quint64>(h + HeaderJournalSequence);
+    count_ = int(count);
+
+    if (verifyChecksums
+        && (qFromLittleEndian<quint32>(h + HeaderRecordsCrc) != crc32(records_, qint64(recordsBytes))
+            || qFromLittleEndian<quint32>(h + HeaderIndexCrc) != crc32(data_ + indexOffset, qint64(count) * 4)
+            || qFromLittleEndian<quint32>(h + HeaderHeapCrc) != crc32(heap_, qint64(heapSize)))) {
+        close();
+        return setError(errorMessage, QStringLiteral("快照数据校验失败，文件可能已损坏"));
+    }
+    return true;
+}
+
+void CatalogSnapshot::close()
+{
+    if (data_) file_.unmap(const_cast<uchar *>(data_));
+    if (file_.isOpen()) file_.close();
+    data_ = nullptr;
+    size_ = 0;
+    count_ = 0;
+    records_ = nullptr;
+    heap_ = nullptr;
+    heapSize_ = 0;
+    journalSequence_ = 0;
+}
+
+bool CatalogSnapshot::isOpen() const
+{
+    return data_ != nullptr;
+}
+
+int CatalogSnapshot::count() const
+{
+    return count_;
+}
+
+quint64 CatalogSnapshot::journalSequence() const
+{
+    return journalSequence_;
+}
+
+const uchar *CatalogSnapshot::record(int row) const
+{
+    return records_ + qint64(row) * kRecordSize;
+}
+
+QByteArray CatalogSnapshot::rawStringAt(int row, int field) const
+{
+    const uchar *r = record(row);
+    const quint32 offset = qFromLittleEndian<quint32>(r + field);
+    const quint32 length = qFromLittleEndian<quint32>(r + field + 4);
+    // 未做整段校验时也不能越界读取
+    if (quint64(offset) + length > heapSize_) return QByteArray();
+    return QByteArray::fromRawData(reinterpret_cast<const char *>(heap_ + offset), int(length));
+}
+
+QString CatalogSnapshot::stringAt(int row, int field) const
+{
+    return QString::fromUtf8(rawStringAt(row, field));
+}
+
+Book CatalogSnapshot::bookAt(int row) const
+{
+    const uchar *r = record(row);
+    Book b;
+    b.indexId = stringAt(row, RecordIndexId);
+    b.name = stringAt(row, RecordName);
+    b.location = stringAt(row, RecordLocation);
+    b.category = stringAt(row, RecordCategory);
+    b.quantity = qFromLittleEndian<qint32>(r + RecordQuantity);
+    b.price = decodeDouble(r + RecordPrice);
+    b.inDate = decodeDate(qFromLittleEndian<qint32>(r + RecordInDate));
+    b.returnDate = decodeDate(qFromLittleEndian<qint32>(r + RecordReturnDate));
+    b.borrowCount = qFromLittleEndian<qint32>(r + RecordBorrowCount);
+    b.available = qFromLittleEndian<quint32>(r + RecordFlags) & kFlagAvailable;
+    return b;
+}
+
+bool CatalogSnapshot::write(const QString &filePath, const QVector<Book> &books, quint64 journalSequence,
+                            QString *errorMessage)
+{
+    const int count = int(books.size());
+    QByteArray records(qsizetype(count) * kRecordSize, '\0');
+    QByteArray heap;
+    QVector<QByteArray> ids(count);
+    QHash<QString, QPair<quint32, quint32>> interned;   // 分类/馆藏地址去重
+
+    bool heapOverflow = false;
+    auto putString = [&](const QString &s, bool intern, uchar *dst) {
+        QPair<quint32, quint32> ref;
+        const auto it = intern ? interned.constFind(s) : interned.constEnd();
+        if (it != interned.constEnd()) {
+            ref = it.value();
+        } else {
+            const QByteArray utf8 = s.toUtf8();
+            if (quint64(heap.size()) + utf8.size() > std::numeric_limits<quint32>::max()) heapOverflow = true;
+            ref = qMakePair(quint32(heap.size()), quint32(utf8.size()));
+            heap.append(utf8);
+            if (intern) interned.insert(s, ref);
+        }
+        qToLittleEndian<quint32>(ref.first, dst);
+        qToLittleEndian<quint32>(ref.second, dst + 4);
+    };
+
+    for (int i = 0; i < count; ++i) {
+        const Book &b = books.at(i);
+        uchar *r = reinterpret_cast<uchar *>(records.data()) + qint64(i) * kRecordSize;
+        putString(b.indexId, false, r + RecordIndexId);
+        putString(b.name, false, r + RecordName);
+        putString(b.location, true, r + RecordLocation);
+        putString(b.category, true, r + RecordCategory);
+        encodeDouble(b.price, r + RecordPrice);
+        qToLittleEndian<qint32>(b.quantity, r + RecordQuantity);
+        qToLittleEndian<qint32>(b.borrowCount, r + RecordBorrowCount);
+        qToLittleEndian<qint32>(encodeDate(b.inDate), r + RecordInDate);
+        qToLittleEndian<qint32>(encodeDate(b.returnDate), r + RecordReturnDate);
+        qToLittleEndian<quint32>(b.available ? kFlagAvailable : 0, r + RecordFlags);
+        ids[i] = b.indexId.toUtf8();
+    }
+    if (heapOverflow) return setError(errorMessage, QStringLiteral("字符串数据超过快照格式上限"));
+
+    QVector<quint32> order(count);
+    for (int i = 0; i < count; ++i) order[i] = quint32(i);
+    std::sort(order.begin(), order.end(), [&ids](quint32 a, quint32 b) {
+        return compareBytes(ids[a].constData(), ids[a].size(), ids[b].constData(), ids[b].size()) < 0;
+    });
+    const quint64 indexEnd = kHeaderSize + quint64(count) * kRecordSize + quint64(count) * 4;
+    QByteArray index(int(align8(indexEnd) - (indexEnd - quint64(count) * 4)), '\0');
+    for (int i = 0; i < count; ++i) {
+        qToLittleEndian<quint32>(order[i], reinterpret_cast<uchar *>(index.data()) + qint64(i) * 4);
+    }
+
+    uchar header[kHeaderSize];
+    std::memset(header, 0, sizeof header);
+    std::memcpy(header + HeaderMagic, kMagic, sizeof kMagic);
+    qToLittleEndian<quint32>(kVersion, header + HeaderVersion);
+    qToLittleEndian<quint32>(kHeaderSize, header + HeaderSizeField);
+    qToLittleEndian<quint32>(kRecordSize, header + HeaderRecordSize);
+    qToLittleEndian<quint32>(quint32(count), header + HeaderRecordCount);
+    qToLittleEndian<quint64>(quint64(heap.size()), header + HeaderHeapSize);
+    qToLittleEndian<quint32>(crc32(records.constData(), records.size()), header + HeaderRecordsCrc);
+    qToLittleEndian<quint32>(crc32(index.constData(), qint64(count) * 4), header + HeaderIndexCrc);
+    qToLittleEndian<quint32>(crc32(heap.constData(), heap.size()), header + HeaderHeapCrc);
+    qToLittleEndian<quint64>(journalSequence, header + HeaderJournalSequence);
+    qToLittleEndian<quint32>(crc32(header, HeaderCrc), header + HeaderCrc);
+
+    // QSaveFile 先写临时文件再原子替换，写入中途失败不会破坏旧快照
+    QSaveFile f(filePath);
+    if (!f.open(QIODevice::WriteOnly)) {
+        return setError(errorMessage, QStringLiteral("无法写入文件: ") + filePath);
+    }
+    f.write(reinterpret_cast<const char *>(header), kHeaderSize);
+    f.write(records);
+    f.write(index);
+    f.write(heap);
+    if (!f.commit()) {
+        return setError(errorMessage, QStringLiteral("无法写入文件: ") + filePath);
+    }
+    return true;
+}
+
+bool CatalogSnapshot::isSnapshotFile(const QString &filePath)
+{
+    QFile f(filePath);
+    if (!f.open(QIODevice::ReadOnly)) return false;
+    const QByteArray head = f.read(sizeof kMagic);
+    return head.size() == int(sizeof kMagic) && std::memcmp(head.constData(), kMagic, sizeof kMagic) == 0;
+}
@@ -0,0 +1,58 @@
+#ifndef CATALOGSNAPSHOT_H
+#define CATALOGSNAPSHOT_H
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+#include "book.h"
+
+// 二进制图书快照（*.njlib），所有整数均为小端序：
+//
+//   文件头   64 字节：魔数、版本、记录数、各段 CRC-32、日志序号，以及文件头自身的 CRC-32
+//   记录段   recordCount 条定长记录（64 字节），字符串以 (偏移, 长度) 引用字符串堆
+//   索引段   recordCount 个 quint32 行号，按 indexId 的 UTF-8 字节序排列；目前只参与校验，加载时不读取
+//   字符串堆 UTF-8 字符串；重复的分类/馆藏地址只存一份
+//
+// 打开时通过 QFile::map 映射整个文件，bookAt 直接从映射区解码一条记录，不经过整文件的读缓冲；
+// 加载（LibraryManager::loadFromSnapshot）仍逐条解码全部记录。JSON 仍作为导入/导出格式保留。
+class CatalogSnapshot {
+public:
+    CatalogSnapshot();
+    ~CatalogSnapshot();
+
+    CatalogSnapshot(const CatalogSnapshot &) = delete;
+    CatalogSnapshot &operator=(const CatalogSnapshot &) = delete;
+
+    // verifyChecksums 为 false 时只校验文件头，跳过整段 CRC 以获得最快的打开速度
+    bool open(const QString &filePath, QString *errorMessage = nullptr, bool verifyChecksums = true);
+    void close();
+    bool isOpen() const;
+
+    int count() const;
+    quint64 journalSequence() const;
+    Book bookAt(int row) const;
+
+    // journalSequence 记录快照对应的日志位置，独立保存的快照传 0
+    static bool write(const QString &filePath, const QVector<Book> &books, quint64 journalSequence,
+                      QString *errorMessage = nullptr);
+    // 只检查魔数，用于区分快照与 JSON 文件
+    static bool isSnapshotFile(const QString &filePath);
+
+private:
+    const uchar *record(int row) const;
+    QString stringAt(int row, int field) const;
+    QByteArray rawStringAt(int row, int field) const;
+
+private:
+    QFile file_;
+    const uchar *data_ = nullptr;
+    qint64 size_ = 0;
+    int count_ = 0;
+    const uchar *records_ = nullptr;
+    const uchar *heap_ = nullptr;
+    quint64 heapSize_ = 0;
+    quint64 journalSequence_ = 0;
+};
+
+#endif // CATALOGSNAPSHOT_H
@@ -0,0 +1,31 @@
+#include "checksum.h"
+
+namespace {
+
+struct Crc32Table {
+    quint32 entries[256];
+
+    Crc32Table()
+    {
+        for (quint32 i = 0; i < 256; ++i) {
+            quint32 c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            entries[i] = c;
+        }
+    }
+};
+
+} // namespace
+
+quint32 crc32(const void *data, qint64 size, quint32 crc)
+{
+    static const Crc32Table table;
+    const uchar *p = static_cast<const uchar *>(data);
+    crc = ~crc;
+    for (qint64 i = 0; i < size; ++i) {
+        crc = table.entries[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
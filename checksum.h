@@ -0,0 +1,9 @@
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <QtGlobal>
+
+// CRC-32（IEEE 802.3，与 zlib 相同）。可分段计算：把上一段的结果作为 crc 传入
+quint32 crc32(const void *data, qint64 size, quint32 crc = 0);
+
+#endif // CHECKSUM_H
@@ -0,0 +1,181 @@
+#include "chinesetext.h"
+
+#include "chinesetextdata.h"
+
+#include <QVarLengthArray>
+#include <QVector>
+
+#include <algorithm>
+
+namespace ChineseText {
+
+namespace {
+
+// 以 UTF-16 码元为下标的平铺表，查一次只是一次数组访问
+struct Tables {
+    QVector<ushort> simplified;      // 码元 -> 简体码元（不变时为自身）
+    QVector<short> syllableOf;       // 码元 -> 拼音编号，-1 表示表中没有
+    QVector<QString> syllables;
+
+    Tables()
+        : simplified(0x10000)
+        , syllableOf(0x10000, -1)
+    {
+        for (int c = 0; c < 0x10000; ++c) simplified[c] = ushort(c);
+        const QString traditional = QString::fromUtf8(ChineseTextData::kTraditional);
+        const QString simple = QString::fromUtf8(ChineseTextData::kSimplified);
+        for (int i = 0; i < traditional.size() && i < simple.size(); ++i) {
+            simplified[traditional[i].unicode()] = simple[i].unicode();
+        }
+        syllables.reserve(ChineseTextData::kPinyinCount);
+        for (int i = 0; i < ChineseTextData::kPinyinCount; ++i) {
+            syllables.append(QString::fromLatin1(ChineseTextData::kPinyin[i].syllable));
+            for (QChar c : QString::fromUtf8(ChineseTextData::kPinyin[i].characters)) {
+                syllableOf[c.unicode()] = short(i);
+            }
+        }
+    }
+};
+
+const Tables &tables()
+{
+    static const Tables instance;
+    return instance;
+}
+
+QChar toHalfWidth(QChar c)
+{
+    const ushort u = c.unicode();
+    if (u == 0x3000) return QChar(' ');
+    if (u >= 0xFF01 && u <= 0xFF5E) return QChar(ushort(u - 0xFEE0));
+    return c;
+}
+
+// pinyin() 与 initials() 的共同部分：whole 为 true 时输出全拼，否则输出首字母
+QString romanize(const QString &text, bool whole)
+{
+    const Tables &t = tables();
+    const QString normalized = normalize(text);
+    QString result;
+    result.reserve(normalized.size() * (whole ? 4 : 1));
+    for (QChar c : normalized) {
+        const short syllable = t.syllableOf[c.unicode()];
+        if (syllable >= 0) {
+            const QString &s = t.syllables[syllable];
+            if (whole) result += s;
+            else result += s[0];
+        } else if (c.unicode() < 0x80) {
+            if (c.isLetterOrNumber()) result += c;
+        } else if (!c.isSpace() && !c.isPunct()) {
+            result += c;
+        }
+    }
+    return result;
+}
+
+// 排序键的分隔字节：都小于键中出现的字母、数字和其他字符的编码
+const char kLevelSeparator = 0x00;   // 拼音部分结束，后接原文
+const char kWordEnd = 0x01;          // 一个音节或一个连写的字母词结束
+const char kNumber = 0x10;           // 其后为有效位数和各位数字
+
+bool isAsciiLetter(ushort u)
+{
+    return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z');
+}
+
+bool isAsciiDigit(ushort u)
+{
+    return u >= '0' && u <= '9';
+}
+
+} // namespace
+
+QString normalize(const QString &text)
+{
+    const Tables &t = tables();
+    QString result(text.size(), Qt::Uninitialized);
+    QChar *out = result.data();
+    for (int i = 0; i < text.size(); ++i) {
+        out[i] = QChar(t.simplified[toHalfWidth(text[i]).unicode()]);
+    }
+    return result.toLower();
+}
+
+QString pinyin(const QString &text)
+{
+    return romanize(text, true);
+}
+
+QString initials(const QString &text)
+{
+    return romanize(text, false);
+}
+
+QByteArray sortKey(const QString &text)
+{
+    const Tables &t = tables();
+    const QString normalized = normalize(text);
+    const int n = normalized.size();
+    QByteArray key;
+    key.reserve(n * 4 + text.size() * 2 + 1);
+    for (int i = 0; i < n;) {
+        const ushort u = normalized[i].unicode();
+        const short syllable = t.syllableOf[u];
+        if (syllable >= 0) {
+            for (QChar c : t.syllables[syllable]) key.append(char(c.unicode()));
+            key.append(kWordEnd);
+            ++i;
+        } else if (isAsciiLetter(u)) {
+            while (i < n && isAsciiLetter(normalized[i].unicode())) key.append(char(normalized[i++].unicode()));
+            key.append(kWordEnd);
+        } else if (isAsciiDigit(u)) {
+            // 去掉前导零，先比位数再逐位比较
+            while (i < n && normalized[i].unicode() == '0') ++i;
+            int end = i;
+            while (end < n && isAsciiDigit(normalized[end].unicode())) ++end;
+            key.append(kNumber);
+            key.append(char(qMin(end - i, 0xff)));
+            for (; i < end; ++i) key.append(char(normalized[i].unicode()));
+        } else if (u < 0x80 || normalized[i].isSpace() || normalized[i].isPunct()) {
+            ++i;
+        } else {
+            // UTF-8 式的三字节编码：保持码元顺序，且每个字节都不小于 0x80
+            key.append(char(0xe0 | (u >> 12)));
+            key.append(char(0x80 | ((u >> 6) & 0x3f)));
+            key.append(char(0x80 | (u & 0x3f)));
+            ++i;
+        }
+    }
+    key.append(kLevelSeparator);
+    for (QChar c : text) {
+        key.append(char(c.unicode() >> 8));
+        key.append(char(c.unicode() & 0xff));
+    }
+    return key;
+}
+
+int editDistance(const QString &a, const QString &b, int maxDistance)
+{
+    const int n = a.size();
+    const int m = b.size();
+    if (qAbs(n - m) > maxDistance) return maxDistance + 1;
+    // 两行滚动的动态规划；某一行的最小值已超过上限时提前结束
+    QVarLengthArray<int, 128> buffer(2 * (m + 1));
+    int *previous = buffer.data();
+    int *current = previous + m + 1;
+    for (int j = 0; j <= m; ++j) previous[j] = j;
+    for (int i = 1; i <= n; ++i) {
+        current[0] = i;
+        int rowMin = current[0];
+        for (int j = 1; j <= m; ++j) {
+            const int substitution = previous[j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1);
+            current[j] = std::min({ previous[j] + 1, current[j - 1] + 1, substitution });
+            rowMin = std::min(rowMin, current[j]);
+        }
+        if (rowMin > maxDistance) return maxDistance + 1;
+        std::swap(previous, current);
+    }
+    return std::min(previous[m], maxDistance + 1);
+}
+
+} // namespace ChineseText
@@ -0,0 +1,30 @@
+#ifndef CHINESETEXT_H
+#define CHINESETEXT_H
+
+#include <QByteArray>
+#include <QString>
+
+// 中文检索用的文本处理：归一化、拼音与编辑距离
+//
+// 对照表为本地数据（见 chinesetextdata.cpp）：拼音覆盖 GB2312 汉字，每字只取一个常用读音，
+// 多音字不做上下文判断；繁简转换只做逐字对照，不处理一对多的词语。
+namespace ChineseText {
+
+// 全角字符转半角、转小写、繁体转简体；逐字映射，不改变汉字个数
+QString normalize(const QString &text);
+// 归一化后的全拼，不带声调和分隔符：红楼梦 -> hongloumeng
+// 英文字母和数字原样保留，标点和空白丢弃，表中没有的其他字符原样保留
+QString pinyin(const QString &text);
+// 拼音首字母：红楼梦 -> hlm；非汉字字符的处理同 pinyin()
+QString initials(const QString &text);
+// 排序键：按 memcmp 比较两个键即得到书目按拼音的顺序
+// 逐字按拼音音节比较（西安 < 先），字母连写视为一个词与拼音交错排列，连续数字按数值比较
+// （第2卷 < 第10卷），标点和空白忽略，表中没有的字符排在字母之后；
+// 以上都相同时按原文的 UTF-16 码元区分，不同的文本得到不同的键
+QByteArray sortKey(const QString &text);
+// a 与 b 的编辑距离（插入、删除、替换各计 1）；超过 maxDistance 时返回 maxDistance + 1
+int editDistance(const QString &a, const QString &b, int maxDistance);
+
+} // namespace ChineseText
+
+#endif // CHINESETEXT_H
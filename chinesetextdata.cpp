@@ -0,0 +1,580 @@
+// 由 ICU 的 Han-Latin 与 Traditional-Simplified 转换生成，请勿手工编辑
+// 拼音覆盖 GB2312 的 6763 个汉字，每字只取一个常用读音；繁简对照覆盖 Big5 中与简体不同的单字
+#include "chinesetextdata.h"
+
+namespace ChineseTextData {
+
+const PinyinEntry kPinyin[] = {
+    { "a", u8"啊阿嗄锕" },
+    { "ai", u8"埃挨哎唉哀皑癌蔼矮艾碍爱隘捱嗳嗌嫒瑷暧砹锿霭" },
+    { "an", u8"鞍氨安俺按暗岸胺案谙埯揞犴庵桉铵鹌黯" },
+    { "ang", u8"肮昂盎" },
+    { "ao", u8"凹敖熬翱袄傲奥懊澳坳拗嗷岙廒遨媪骜獒聱螯鏊鳌鏖" },
+    { "ba", u8"芭捌扒叭吧笆八疤巴拔跋靶把耙坝霸罢爸茇菝岜灞钯粑鲅魃" },
+    { "bai", u8"白柏百摆佰败拜稗捭掰擘" },
+    { "ban", u8"斑班搬扳般颁板版扮拌伴瓣半办绊阪坂钣瘢癍舨" },
+    { "bang", u8"邦帮梆榜膀绑棒磅蚌镑傍谤蒡浜" },
+    { "bao", u8"苞胞包褒薄雹保堡饱宝抱报暴豹鲍爆勹葆孢煲鸨褓趵龅" },
+    { "bei", u8"杯碑悲卑北辈背贝钡倍狈备惫焙被孛陂邶蓓呗悖碚鹎褙鐾鞴" },
+    { "ben", u8"奔苯本笨畚坌贲锛" },
+    { "beng", u8"崩绷甭泵蹦迸嘣甏" },
+    { "bi", u8"逼鼻比鄙笔彼碧蓖蔽毕毙毖币庇痹闭敝弊必壁臂避陛匕俾荜荸萆薜吡哔狴庳愎滗濞弼妣婢嬖璧畀铋秕裨筚箅篦舭襞跸髀" },
+    { "bian", u8"鞭边编贬扁便变卞辨辩辫遍匾弁苄忭汴缏煸砭碥窆褊蝙笾鳊" },
+    { "biao", u8"标彪膘表婊骠杓飑飙飚灬镖镳瘭裱鳔髟" },
+    { "bie", u8"鳖憋别瘪蹩" },
+    { "bin", u8"彬斌濒滨宾摈傧豳缤玢槟殡膑镔髌鬓" },
+    { "bing", u8"兵冰柄丙秉饼炳病并禀冫邴摒" },
+    { "bo", u8"剥玻菠播拨钵波博勃搏铂箔伯帛舶脖膊渤驳卜亳啵饽檗礴钹鹁簸跛踣" },
+    { "bu", u8"捕哺补埠不布步簿部怖埔卟逋瓿晡钚钸醭" },
+    { "ca", u8"擦嚓礤" },
+    { "cai", u8"猜裁材才财睬踩采彩菜蔡" },
+    { "can", u8"餐参蚕残惭惨灿掺孱骖璨粲黪" },
+    { "cang", u8"苍舱仓沧藏伧" },
+    { "cao", u8"操糙槽曹草艹嘈漕螬艚" },
+    { "ce", u8"厕策侧册测恻" },
+    { "cen", u8"岑涔" },
+    { "ceng", u8"层蹭曾噌" },
+    { "cha", u8"插叉茬茶查碴搽察岔差诧猹馇汊姹杈槎檫锸镲衩" },
+    { "chai", u8"拆柴豺侪钗瘥虿" },
+    { "chan", u8"搀蝉馋谗缠铲产阐颤冁谄蒇廛忏潺澶羼婵骣觇禅镡蟾躔" },
+    { "chang", u8"昌猖场尝常偿肠厂敞畅唱倡伥鬯苌菖徜怅惝阊娼嫦昶氅鲳" },
+    { "chao", u8"超抄钞朝嘲潮巢吵炒怊晁焯耖" },
+    { "che", u8"车扯撤掣彻澈坼屮砗" },
+    { "chen", u8"郴臣辰尘晨忱沉陈趁衬谌谶抻嗔宸琛榇碜龀" },
+    { "cheng", u8"撑称城橙成呈乘程惩澄诚承逞骋秤丞埕枨柽晟塍瞠铖裎蛏酲" },
+    { "chi", u8"吃痴持池迟弛驰耻齿侈尺赤翅斥炽傺坻墀茌叱哧啻嗤彳饬媸敕眵鸱瘛褫蚩螭笞篪踟魑" },
+    { "chong", u8"充冲虫崇宠茺忡憧铳舂艟" },
+    { "chou", u8"抽酬畴踌稠愁筹仇绸瞅丑臭俦帱惆瘳雠" },
+    { "chu", u8"初出橱厨躇锄雏滁除楚础储矗搐触处畜亍刍怵憷绌杵楮樗褚蜍蹰黜" },
+    { "chuai", u8"揣搋啜嘬膪踹" },
+    { "chuan", u8"川穿椽传船喘串舛遄巛氚钏舡" },
+    { "chuang", u8"疮窗幢床闯创怆" },
+    { "chui", u8"吹炊捶锤垂椎陲棰槌" },
+    { "chun", u8"春椿醇唇淳纯蠢莼鹑蝽" },
+    { "chuo", u8"戳绰辶辍踔龊" },
+    { "ci", u8"疵茨磁雌辞慈瓷词此刺赐次伺茈呲祠鹚糍" },
+    { "cong", u8"聪葱囱匆从丛苁淙骢琮璁枞" },
+    { "cou", u8"凑辏腠" },
+    { "cu", u8"粗醋簇促蔟徂猝殂酢蹙蹴" },
+    { "cuan", u8"蹿篡窜汆撺爨镩" },
+    { "cui", u8"摧崔催脆瘁粹淬翠萃啐悴璀榱毳" },
+    { "cun", u8"村存寸忖皴" },
+    { "cuo", u8"磋撮搓措挫错厝嵯脞锉矬痤鹾蹉" },
+    { "da", u8"搭达答瘩打大耷哒嗒怛妲沓褡笪靼鞑" },
+    { "dai", u8"呆歹傣戴带殆代贷袋待逮怠埭甙呔岱迨骀绐玳黛" },
+    { "dan", u8"耽担丹单郸掸胆旦氮但惮淡诞弹蛋儋萏啖澹殚赕眈疸瘅聃箪" },
+    { "dang", u8"当挡党荡档谠凼菪宕砀铛裆" },
+    { "dao", u8"刀捣蹈倒岛祷导到稻悼道盗刂叨忉氘焘纛" },
+    { "de", u8"德得的地锝" },
+    { "deng", u8"蹬灯登等瞪凳邓噔嶝戥磴镫簦" },
+    { "di", u8"堤低滴迪敌笛狄涤翟嫡抵底蒂第帝弟递缔氐籴诋谛邸荻嘀娣柢棣觌砥碲睇镝羝骶" },
+    { "dian", u8"颠掂滇碘点典靛垫电佃甸店惦奠淀殿阽坫巅玷钿癜癫簟踮" },
+    { "diao", u8"碉叼雕凋刁掉吊钓调铞铫貂鲷" },
+    { "die", u8"跌爹碟蝶迭谍叠垤堞揲喋嗲牒瓞耋蹀鲽" },
+    { "ding", u8"丁盯叮钉顶鼎锭定订仃啶玎腚碇铤疔耵酊" },
+    { "diu", u8"丢铥" },
+    { "dong", u8"东冬董懂动栋侗恫冻洞垌咚岽峒氡胨胴硐鸫" },
+    { "dou", u8"兜抖斗陡豆逗痘都蔸窦蚪篼" },
+    { "du", u8"督毒犊独读堵睹赌杜镀肚度渡妒芏嘟渎椟牍碡蠹笃髑黩" },
+    { "duan", u8"端短锻段断缎椴煅簖" },
+    { "dui", u8"堆兑队对怼憝碓镦" },
+    { "dun", u8"墩吨蹲敦顿囤钝盾遁沌炖砘礅盹趸" },
+    { "duo", u8"掇哆多夺垛躲朵跺舵剁惰堕咄哚缍柁铎裰踱" },
+    { "e", u8"蛾峨鹅俄额讹娥恶厄扼遏鄂饿噩谔垩苊莪萼呃愕阏屙婀轭腭锇锷鹗颚鳄" },
+    { "ei", u8"诶" },
+    { "en", u8"恩蒽摁" },
+    { "er", u8"而儿耳尔饵洱二贰佴迩珥铒鸸鲕" },
+    { "fa", u8"发罚筏伐乏阀法珐垡砝" },
+    { "fan", u8"藩帆番翻樊矾钒繁凡烦反返范贩犯饭泛蕃蘩幡梵燔畈蹯" },
+    { "fang", u8"坊芳方肪房防妨仿访纺放匚邡彷枋钫舫鲂" },
+    { "fei", u8"菲非啡飞肥匪诽吠肺废沸费芾狒悱淝妃绯榧腓斐扉镄痱蜚篚翡霏鲱" },
+    { "fen", u8"芬酚吩氛分纷坟焚汾粉奋份忿愤粪偾瀵棼鲼鼢" },
+    { "feng", u8"丰封枫蜂峰锋风疯烽逢冯缝讽奉凤俸酆葑唪沣砜" },
+    { "fou", u8"否缶" },
+    { "fu", u8"佛夫敷肤孵扶拂辐幅氟符伏俘服浮涪福袱弗甫抚辅俯釜斧腑府腐赴副覆赋复傅付阜父腹负富讣附妇缚咐匐凫阝郛芙苻茯莩菔拊呋呒幞怫滏艴孚驸绂绋桴赙祓砩黻黼罘稃馥蚨蜉蝠蝮麸趺跗鲋鳆" },
+    { "ga", u8"噶嘎尬呷尕尜旮钆" },
+    { "gai", u8"该改概钙盖溉丐陔垓戤赅" },
+    { "gan", u8"干甘杆柑竿肝赶感秆敢赣坩苷尴擀泔淦澉绀橄旰矸疳酐" },
+    { "gang", u8"冈刚钢缸肛纲岗港杠戆罡筻" },
+    { "gao", u8"篙皋高膏羔糕搞镐稿告睾诰郜藁缟槔槁杲锆" },
+    { "ge", u8"哥歌搁戈鸽胳疙割革葛格阁隔铬个各咯鬲仡哿圪塥嗝纥搿膈硌镉袼虼舸骼" },
+    { "gei", u8"给" },
+    { "gen", u8"根跟亘茛哏艮" },
+    { "geng", u8"耕更庚羹埂耿梗哽赓绠鲠" },
+    { "gong", u8"工攻功恭龚供躬公宫弓巩汞拱贡共廾珙肱蚣觥" },
+    { "gou", u8"钩勾沟苟狗垢构购够佝诟岣遘媾缑枸觏彀笱篝鞲" },
+    { "gu", u8"辜菇咕箍估沽孤姑鼓古蛊骨谷股故顾固雇嘏诂菰呱崮汩梏轱牯牿臌毂瞽罟钴锢鸪鹄痼蛄酤觚鲴鹘" },
+    { "gua", u8"刮瓜剐寡挂褂卦诖栝胍鸹聒" },
+    { "guai", u8"乖拐怪掴" },
+    { "guan", u8"棺关官冠观管馆罐惯灌贯倌莞掼涫盥鹳鳏" },
+    { "guang", u8"光广逛咣犷桄胱" },
+    { "gui", u8"瑰规圭硅归龟闺轨鬼诡癸桂柜跪贵刽傀炔匦刿庋宄妫桧晷皈簋鲑鳜" },
+    { "gun", u8"辊滚棍丨衮绲磙鲧" },
+    { "guo", u8"锅郭国果裹过馘埚呙帼崞猓椁虢蜾蝈" },
+    { "ha", u8"蛤哈铪" },
+    { "hai", u8"骸孩海氦亥害骇还咳嗨胲醢" },
+    { "han", u8"酣憨邯韩含涵寒函喊罕翰撼捍旱憾悍焊汗汉邗菡撖阚瀚晗焓顸颔蚶鼾" },
+    { "hang", u8"夯杭航沆绗珩颃" },
+    { "hao", u8"壕嚎豪毫郝好耗号浩貉蒿薅嗥嚆濠灏昊皓颢蚝" },
+    { "he", u8"呵喝荷菏核禾和何合盒阂河涸赫褐鹤贺诃劾壑嗬阖曷盍颌蚵翮" },
+    { "hei", u8"嘿黑" },
+    { "hen", u8"痕很狠恨" },
+    { "heng", u8"哼亨横衡恒蘅桁" },
+    { "hong", u8"轰哄烘虹鸿洪宏弘红黉訇讧荭蕻薨闳泓" },
+    { "hou", u8"喉侯猴吼厚候后堠後逅瘊篌糇鲎骺" },
+    { "hu", u8"呼乎忽瑚壶葫胡蝴狐糊湖弧虎唬护互沪户冱唿囫岵猢怙惚浒滹琥槲轷觳烀煳戽扈祜瓠鹕鹱虍笏醐斛" },
+    { "hua", u8"花哗华猾滑画划化话骅桦铧" },
+    { "huai", u8"槐徊怀淮坏踝" },
+    { "huan", u8"欢环桓缓换患唤痪豢焕涣宦幻郇奂萑擐圜獾洹浣漶寰逭缳锾鲩鬟" },
+    { "huang", u8"荒慌黄磺蝗簧皇凰惶煌晃幌恍谎隍徨湟潢遑璜肓癀蟥篁鳇" },
+    { "hui", u8"灰挥辉徽恢蛔回毁悔慧卉惠晦贿秽会烩汇讳诲绘诙茴荟蕙咴哕喙隳洄浍彗缋珲晖恚虺蟪麾" },
+    { "hun", u8"荤昏婚魂浑混诨馄阍溷" },
+    { "huo", u8"豁活伙火获或惑霍货祸劐藿攉嚯夥砉钬锪镬耠蠖" },
+    { "ji", u8"击圾基机畸稽积箕肌饥迹激讥鸡姬绩缉吉极棘辑籍集及急疾汲即嫉级挤几脊己蓟技冀季伎祭剂悸济寄寂计记既忌际妓继纪藉丌亟乩剞佶偈诘墼芨芰荠蒺蕺掎叽咭哜唧岌嵴洎彐屐骥畿玑楫殛戟戢赍觊犄齑矶羁嵇稷瘠虮笈笄暨跻跽霁鲚鲫髻麂" },
+    { "jia", u8"嘉枷夹佳家加荚颊贾甲钾假稼价架驾嫁茄伽郏葭岬浃迦珈戛胛恝铗镓痂瘕蛱笳袈跏" },
+    { "jian", u8"歼监坚尖笺间煎兼肩艰奸缄茧检柬碱硷拣捡简俭剪减荐鉴践贱见键箭件健舰剑饯渐溅涧建僭谏谫菅蒹搛囝湔蹇謇缣枧楗戋戬牮犍毽腱睑锏鹣裥笕翦趼踺鲣鞯" },
+    { "jiang", u8"僵姜将浆江疆蒋桨奖讲匠酱降茳洚绛缰犟礓耩糨豇" },
+    { "jiao", u8"蕉椒礁焦胶交郊浇骄娇搅铰矫侥脚狡角饺缴绞剿教酵轿较叫窖佼僬艽茭挢噍峤徼湫姣敫皎鹪蛟醮跤鲛" },
+    { "jie", u8"揭接皆秸街阶截劫节杰捷睫竭洁结解姐戒芥界借介疥诫届讦卩拮喈嗟婕孑桀碣疖颉蚧羯鲒骱" },
+    { "jin", u8"巾筋斤金今津襟紧锦仅谨进靳晋禁近烬浸尽劲卺荩堇噤馑廑妗缙瑾槿赆觐钅衿矜" },
+    { "jing", u8"荆兢茎睛晶鲸京惊精粳经井警景颈静境敬镜径痉靖竟竞净刭儆阱菁獍憬泾迳弪婧肼胫腈旌靓" },
+    { "jiong", u8"炯窘冂迥炅扃" },
+    { "jiu", u8"揪究纠玖韭久灸九酒厩救旧臼舅咎就疚僦啾阄柩桕鸠鹫赳鬏" },
+    { "ju", u8"桔鞠拘狙疽居驹菊局咀矩举沮聚拒据巨具距踞锯俱句惧炬剧倨讵苣苴莒菹掬遽屦琚椐榘榉橘犋飓钜锔窭裾趄醵踽龃雎鞫" },
+    { "juan", u8"捐鹃娟倦眷卷绢鄄狷涓桊蠲锩镌隽" },
+    { "jue", u8"嚼撅攫抉掘倔爵觉决诀绝厥劂谲矍蕨噘噱崛獗孓珏桷橛爝镢蹶觖" },
+    { "jun", u8"均菌钧军君峻俊竣浚郡骏捃皲麇" },
+    { "ka", u8"喀咖卡佧咔胩" },
+    { "kai", u8"开揩楷凯慨剀垲蒈忾恺铠锎锴" },
+    { "kan", u8"槛刊堪勘坎砍看侃莰戡龛瞰" },
+    { "kang", u8"康慷糠扛抗亢炕伉闶钪" },
+    { "kao", u8"考拷烤靠尻栲犒铐" },
+    { "ke", u8"坷苛柯棵磕颗科壳可渴克刻客课嗑岢恪溘骒缂珂轲氪瞌钶锞稞疴窠颏蝌髁" },
+    { "ken", u8"肯啃垦恳裉龈" },
+    { "keng", u8"坑吭铿" },
+    { "kong", u8"空恐孔控倥崆箜" },
+    { "kou", u8"抠口扣寇芤蔻叩眍筘" },
+    { "ku", u8"枯哭窟苦酷库裤刳堀喾绔骷" },
+    { "kua", u8"夸垮挎跨胯侉" },
+    { "kuai", u8"块筷侩快蒯郐哙狯脍" },
+    { "kuan", u8"宽款髋" },
+    { "kuang", u8"匡筐狂框矿眶旷况诓诳邝圹夼哐纩贶" },
+    { "kui", u8"亏盔岿窥葵奎魁馈愧溃馗匮夔隗蒉揆喹喟悝愦逵暌睽聩蝰篑跬" },
+    { "kun", u8"坤昆捆困悃阃琨锟醌鲲髡" },
+    { "kuo", u8"括扩廓阔蛞" },
+    { "la", u8"垃拉喇蜡腊辣啦剌邋旯砬瘌" },
+    { "lai", u8"莱来赖崃徕涞濑赉睐铼癞籁" },
+    { "lan", u8"蓝婪栏拦篮阑兰澜谰揽览懒缆烂滥岚漤榄斓罱镧褴" },
+    { "lang", u8"琅榔狼廊郎朗浪莨蒗啷阆锒稂螂" },
+    { "lao", u8"捞劳牢老佬姥酪烙涝潦唠崂栳铑铹痨耢醪" },
+    { "le", u8"乐肋了仂叻泐鳓" },
+    { "lei", u8"勒雷镭蕾磊累儡垒擂类泪羸诔嘞嫘缧檑耒酹" },
+    { "leng", u8"棱楞冷塄愣" },
+    { "li", u8"厘梨犁黎篱狸离漓理李里鲤礼莉荔吏栗丽厉励砾历利傈例俐痢立粒沥隶力璃哩俪俚郦坜苈莅蓠藜呖唳喱猁溧澧逦娌嫠骊缡枥栎轹戾砺詈罹锂鹂疠疬蛎蜊蠡笠篥粝醴跞雳鲡鳢黧" },
+    { "lia", u8"俩" },
+    { "lian", u8"联莲连镰廉怜涟帘敛脸链恋炼练蔹奁潋濂琏楝殓臁裢裣蠊鲢" },
+    { "liang", u8"粮凉梁粱良两辆量晾亮谅墚椋踉魉" },
+    { "liao", u8"撩聊僚疗燎寥辽撂镣廖料蓼尥嘹獠寮缭钌鹩" },
+    { "lie", u8"列裂烈劣猎冽埒捩咧洌趔躐鬣" },
+    { "lin", u8"琳林磷霖临邻鳞淋凛赁吝拎蔺啉嶙廪懔遴檩辚膦瞵粼躏麟" },
+    { "ling", u8"玲菱零龄铃伶羚凌灵陵岭领另令酃苓呤囹泠绫柃棂瓴聆蛉翎鲮" },
+    { "liu", u8"溜琉榴硫馏留刘瘤流柳六浏遛骝绺旒熘锍镏鹨鎏" },
+    { "long", u8"龙聋咙笼窿隆垄拢陇垅茏泷珑栊胧砻癃" },
+    { "lou", u8"楼娄搂篓漏陋偻蒌喽嵝镂瘘耧蝼髅" },
+    { "lu", u8"芦卢颅庐炉掳卤虏鲁麓碌露路赂鹿潞禄录陆戮驴吕铝侣旅履屡缕虑氯律率滤绿垆捋撸噜闾泸渌漉逯璐栌榈橹轳辂辘氇胪膂镥稆鸬鹭褛簏舻鲈" },
+    { "luan", u8"峦挛孪滦卵乱脔娈栾鸾銮" },
+    { "lue", u8"掠略锊" },
+    { "lun", u8"抡轮伦仑沦纶论囵" },
+    { "luo", u8"萝螺罗逻锣箩骡裸落洛骆络倮蠃荦摞猡泺漯珞椤脶镙瘰雒" },
+    { "ma", u8"妈麻玛码蚂马骂嘛吗唛犸嬷杩蟆" },
+    { "mai", u8"埋买麦卖迈脉劢荬霾" },
+    { "man", u8"瞒馒蛮满蔓曼慢漫谩墁幔缦熳镘颟螨蹒鳗鞔" },
+    { "mang", u8"芒茫盲氓忙莽邙漭硭蟒" },
+    { "mao", u8"猫茅锚毛矛铆卯茂冒帽貌贸袤茆峁泖瑁昴牦耄旄懋瞀蝥蟊髦" },
+    { "me", u8"么" },
+    { "mei", u8"玫枚梅酶霉煤没眉媒镁每美昧寐妹媚莓嵋猸浼湄楣镅鹛袂魅" },
+    { "men", u8"门闷们扪焖懑钔" },
+    { "meng", u8"萌蒙檬盟锰猛梦孟勐甍瞢懵朦礞虻蜢蠓艋艨" },
+    { "mi", u8"眯醚靡糜迷谜弥米秘觅泌蜜密幂芈冖谧蘼咪嘧猕汨宓弭脒祢敉糸縻麋" },
+    { "mian", u8"棉眠绵冕免勉娩缅面沔渑湎宀腼眄黾" },
+    { "miao", u8"苗描瞄藐秒渺庙妙喵邈缈杪淼眇鹋" },
+    { "mie", u8"蔑灭乜咩蠛篾" },
+    { "min", u8"民抿皿敏悯闽苠岷闵泯缗珉愍鳘" },
+    { "ming", u8"明螟鸣铭名命冥茗溟暝瞑酩" },
+    { "miu", u8"谬" },
+    { "mo", u8"摸摹蘑模膜磨摩魔抹末莫墨默沫漠寞陌谟茉蓦馍嫫殁镆秣瘼耱貊貘麽" },
+    { "mou", u8"谋牟某侔哞缪眸蛑鍪" },
+    { "mu", u8"拇牡亩姆母墓暮幕募慕木目睦牧穆仫坶苜沐毪钼" },
+    { "n", u8"嗯" },
+    { "na", u8"拿哪呐钠那娜纳捺肭镎衲" },
+    { "nai", u8"氖乃奶耐奈鼐艿萘柰" },
+    { "nan", u8"南男难喃囡楠腩蝻赧" },
+    { "nang", u8"囊攮囔馕曩" },
+    { "nao", u8"挠脑恼闹淖孬垴呶猱瑙硇铙蛲" },
+    { "ne", u8"呢讷疒" },
+    { "nei", u8"馁内" },
+    { "nen", u8"嫩恁" },
+    { "neng", u8"能" },
+    { "ni", u8"妮霓倪泥尼拟你匿腻逆溺伲坭猊怩昵旎睨铌鲵" },
+    { "nian", u8"蔫拈年碾撵捻念辗廿埝辇黏鲇鲶" },
+    { "niang", u8"娘酿" },
+    { "niao", u8"鸟尿茑嬲脲袅" },
+    { "nie", u8"捏聂孽啮镊镍涅陧蘖嗫颞臬蹑" },
+    { "nin", u8"您" },
+    { "ning", u8"柠狞凝宁拧泞佞咛甯聍" },
+    { "niu", u8"牛扭钮纽狃忸妞" },
+    { "nong", u8"脓浓农弄侬哝" },
+    { "nou", u8"耨" },
+    { "nu", u8"奴努怒女弩胬孥驽恧钕衄" },
+    { "nuan", u8"暖" },
+    { "nue", u8"虐疟" },
+    { "nuo", u8"挪懦糯诺傩搦喏锘" },
+    { "o", u8"哦喔噢" },
+    { "ou", u8"欧鸥殴藕呕偶沤讴怄瓯耦" },
+    { "pa", u8"啪趴爬帕怕琶葩杷筢" },
+    { "pai", u8"拍排牌徘湃派俳蒎哌" },
+    { "pan", u8"攀潘盘磐盼畔判叛拚爿泮袢襻蟠" },
+    { "pang", u8"乓庞旁耪胖滂逄螃" },
+    { "pao", u8"抛咆刨炮袍跑泡匏狍庖脬疱" },
+    { "pei", u8"呸胚培裴赔陪配佩沛辔帔旆锫醅霈" },
+    { "pen", u8"喷盆湓" },
+    { "peng", u8"砰抨烹澎彭蓬棚硼篷膨朋鹏捧碰堋嘭怦蟛" },
+    { "pi", u8"辟坯砒霹批披劈琵毗啤脾疲皮匹痞僻屁譬丕仳陴邳郫圮埤鼙芘擗噼庀淠媲纰枇甓睥罴铍癖疋蚍蜱貔" },
+    { "pian", u8"篇偏片骗谝骈犏胼翩蹁" },
+    { "piao", u8"飘漂瓢票剽嘌嫖缥殍瞟螵" },
+    { "pie", u8"撇瞥丿苤氕" },
+    { "pin", u8"拼频贫品聘姘嫔榀牝颦" },
+    { "ping", u8"乒坪苹萍平凭瓶评屏俜娉枰鲆" },
+    { "po", u8"泊坡泼颇婆破魄迫粕叵鄱珀钋钷皤笸" },
+    { "pou", u8"剖裒掊" },
+    { "pu", u8"脯扑铺仆莆葡菩蒲朴圃普浦谱曝瀑匍噗溥濮璞攴氆攵镤镨蹼" },
+    { "qi", u8"期欺栖戚妻七凄漆柒沏其棋奇歧畦崎脐齐旗祈祁骑起岂乞企启契砌器气迄弃汽泣讫亓俟圻芑芪萁萋葺蕲嘁屺岐汔淇骐绮琪琦杞桤槭耆祺憩碛颀蛴蜞綦綮蹊鳍麒" },
+    { "qia", u8"掐恰洽葜袷髂" },
+    { "qian", u8"牵扦钎铅千迁签仟谦乾黔钱钳前潜遣浅谴堑嵌欠歉倩佥阡凵芊芡茜掮岍悭慊骞搴褰缱椠肷愆钤虔箝" },
+    { "qiang", u8"枪呛腔羌墙蔷强抢丬戕嫱樯戗炝锖锵镪襁蜣羟跄" },
+    { "qiao", u8"橇锹敲悄桥瞧乔侨巧鞘撬翘峭俏窍劁诮谯荞愀憔缲樵硗跷鞒" },
+    { "qie", u8"切且怯窃郄惬妾挈锲箧" },
+    { "qin", u8"钦侵亲秦琴勤芹擒禽寝沁芩揿吣嗪噙溱檎锓螓衾" },
+    { "qing", u8"青轻氢倾卿清擎晴氰情顷请庆苘圊檠磬蜻罄箐謦鲭黥" },
+    { "qiong", u8"琼穷邛芎茕穹蛩筇跫銎" },
+    { "qiu", u8"秋丘邱球求囚酋泅俅巯犰逑遒楸赇虬蚯蝤裘糗鳅鼽" },
+    { "qu", u8"趋区蛆曲躯屈驱渠取娶龋趣去诎劬蕖蘧岖衢阒璩觑氍朐祛磲鸲癯蛐蠼麴瞿黢" },
+    { "quan", u8"圈颧权醛泉全痊拳犬券劝诠荃犭悛绻辁畎铨蜷筌鬈" },
+    { "que", u8"缺瘸却鹊榷确雀阕阙悫" },
+    { "qun", u8"裙群逡" },
+    { "ran", u8"然燃冉染苒蚺髯" },
+    { "rang", u8"瓤壤攘嚷让禳穰" },
+    { "rao", u8"饶扰绕荛娆桡" },
+    { "re", u8"惹热" },
+    { "ren", u8"壬仁人忍韧任认刃妊纫亻仞荏葚饪轫稔衽" },
+    { "reng", u8"扔仍" },
+    { "ri", u8"日" },
+    { "rong", u8"戎茸蓉荣融熔溶容绒冗嵘狨榕肜蝾" },
+    { "rou", u8"揉柔肉糅蹂鞣" },
+    { "ru", u8"茹蠕儒孺如辱乳汝入褥蓐薷嚅洳溽濡缛铷襦颥" },
+    { "ruan", u8"软阮朊" },
+    { "rui", u8"蕊瑞锐芮蕤枘睿蚋" },
+    { "run", u8"闰润" },
+    { "ruo", u8"若弱偌箬" },
+    { "sa", u8"撒洒萨卅仨挲脎飒" },
+    { "sai", u8"腮鳃塞赛噻" },
+    { "san", u8"三叁伞散馓毵糁" },
+    { "sang", u8"桑嗓丧搡磉颡" },
+    { "sao", u8"搔骚扫嫂埽缫臊瘙鳋" },
+    { "se", u8"瑟色涩啬铯穑" },
+    { "sen", u8"森" },
+    { "seng", u8"僧" },
+    { "sha", u8"莎砂杀刹沙纱傻啥煞厦唼歃铩痧裟霎鲨" },
+    { "shai", u8"筛晒酾" },
+    { "shan", u8"珊苫杉山删煽衫闪陕擅赡膳善汕扇缮剡讪鄯埏芟彡潸姗嬗骟膻钐疝蟮舢跚鳝" },
+    { "shang", u8"墒伤商赏晌上尚裳垧绱殇熵觞" },
+    { "shao", u8"梢捎稍烧芍勺韶少哨邵绍劭苕潲蛸筲艄" },
+    { "she", u8"奢赊蛇舌舍赦摄射慑涉社设厍佘猞滠歙畲麝" },
+    { "shei", u8"谁" },
+    { "shen", u8"砷申呻伸身深娠绅神沈审婶甚肾慎渗什诜谂莘哂渖椹胂矧蜃" },
+    { "sheng", u8"声生甥牲升绳省盛剩胜圣嵊眚笙" },
+    { "shi", u8"匙师失狮施湿诗尸虱十石拾时食蚀实识史矢使屎驶始式示士世柿事拭誓逝势是嗜噬适仕侍释饰氏市恃室视试似谥埘莳蓍弑饣轼贳炻礻铈螫舐筮豉豕鲥鲺" },
+    { "shou", u8"收手首守寿授售受瘦兽扌狩绶艏" },
+    { "shu", u8"蔬枢梳殊抒输叔舒淑疏书赎孰熟薯暑曙署蜀黍鼠属术述树束戍竖墅庶数漱恕倏塾菽摅沭澍姝纾毹腧殳秫" },
+    { "shua", u8"刷耍唰" },
+    { "shuai", u8"摔衰甩帅蟀" },
+    { "shuan", u8"栓拴闩涮" },
+    { "shuang", u8"霜双爽孀" },
+    { "shui", u8"水睡税氵" },
+    { "shun", u8"吮瞬顺舜" },
+    { "shuo", u8"说硕朔烁蒴搠妁槊铄" },
+    { "si", u8"斯撕嘶思私司丝死肆寺嗣四饲巳厮兕厶咝汜泗澌姒驷纟缌祀锶鸶耜蛳笥" },
+    { "song", u8"松耸怂颂送宋讼诵凇菘崧嵩忪悚淞竦" },
+    { "sou", u8"搜艘擞嗽叟薮嗖嗾馊溲飕瞍锼螋" },
+    { "su", u8"苏酥俗素速粟僳塑溯宿诉肃夙谡蔌嗉愫涑簌觫稣" },
+    { "suan", u8"酸蒜算狻" },
+    { "sui", u8"虽隋随绥髓碎岁穗遂隧祟谇荽濉邃燧眭睢" },
+    { "sun", u8"孙损笋荪狲飧榫隼" },
+    { "suo", u8"蓑梭唆缩琐索锁所唢嗦嗍娑桫睃羧" },
+    { "ta", u8"塌他它她塔獭挞蹋踏拓闼溻遢榻铊趿鳎" },
+    { "tai", u8"胎苔抬台泰酞太态汰邰薹肽炱钛跆鲐" },
+    { "tan", u8"坍摊贪瘫滩坛檀痰潭谭谈坦毯袒碳探叹炭郯昙忐钽锬覃" },
+    { "tang", u8"汤塘搪堂棠膛唐糖倘躺淌趟烫傥帑饧溏瑭樘铴镗耥螗螳羰醣" },
+    { "tao", u8"掏涛滔绦萄桃逃淘陶讨套鼗啕洮韬饕" },
+    { "te", u8"特忒忑慝铽" },
+    { "teng", u8"藤腾疼誊滕" },
+    { "ti", u8"梯剔踢锑提题蹄啼体替嚏惕涕剃屉倜荑悌逖绨缇鹈裼醍" },
+    { "tian", u8"天添填田甜恬舔腆掭忝阗殄畋" },
+    { "tiao", u8"挑条迢眺跳佻祧窕蜩笤粜龆鲦髫" },
+    { "tie", u8"贴铁帖萜餮" },
+    { "ting", u8"厅听烃汀廷停亭庭挺艇莛葶婷梃町蜓霆" },
+    { "tong", u8"通桐酮瞳同铜彤童桶捅筒统痛佟僮仝茼嗵恸潼砼" },
+    { "tou", u8"偷投头透亠钭骰" },
+    { "tu", u8"凸秃突图徒途涂屠土吐兔堍荼菟钍酴" },
+    { "tuan", u8"湍团抟彖疃" },
+    { "tui", u8"推颓腿蜕褪退煺" },
+    { "tun", u8"吞屯臀氽饨暾豚" },
+    { "tuo", u8"拖托脱鸵陀驮驼椭妥唾乇佗坨庹沲沱柝橐砣箨酡跎鼍" },
+    { "wa", u8"挖哇蛙洼娃瓦袜佤娲腽" },
+    { "wai", u8"歪外崴" },
+    { "wan", u8"豌弯湾玩顽丸烷完碗挽晚皖惋宛婉万腕剜芄菀纨绾琬脘畹蜿" },
+    { "wang", u8"汪王亡枉网往旺望忘妄罔惘辋魍" },
+    { "wei", u8"威巍微危韦违桅围唯惟为潍维苇萎委伟伪尾纬未蔚味畏胃喂魏位渭谓尉慰卫偎诿隈圩葳薇囗帏帷嵬猥猬闱沩洧涠逶娓玮韪軎炜煨痿艉鲔" },
+    { "wen", u8"瘟温蚊文闻纹吻稳紊问刎阌汶玟璺雯" },
+    { "weng", u8"嗡翁瓮蓊蕹" },
+    { "wo", u8"挝蜗涡窝我斡卧握沃倭莴幄渥肟硪龌" },
+    { "wu", u8"巫呜钨乌污诬屋无芜梧吾吴毋武五捂午舞伍侮坞戊雾晤物勿务悟误兀仵阢邬圬芴唔庑怃忤浯寤迕妩婺骛杌牾焐鹉鹜痦蜈鋈鼯" },
+    { "xi", u8"昔熙析西硒矽晰嘻吸锡牺稀息希悉膝夕惜熄烯溪汐犀檄袭席习媳喜铣洗系隙戏细僖兮隰郗菥葸蓰奚唏徙饩阋浠淅屣嬉玺樨曦觋欷熹禊禧皙穸蜥螅蟋舄舾羲粞翕醯鼷" },
+    { "xia", u8"瞎虾匣霞辖暇峡侠狭下夏吓狎遐瑕柙硖罅黠" },
+    { "xian", u8"掀锨先仙鲜纤咸贤衔舷闲涎弦嫌显险现献县腺馅羡宪陷限线冼苋莶藓岘猃暹娴氙燹祆鹇痫蚬筅籼酰跣跹霰" },
+    { "xiang", u8"相厢镶香箱襄湘乡翔祥详想响享项巷橡像向象芗葙饷庠骧缃蟓鲞飨" },
+    { "xiao", u8"萧硝霄哮嚣销消宵淆晓小孝校肖啸笑效哓崤潇逍骁绡枭枵筱箫魈" },
+    { "xie", u8"楔些歇蝎鞋协挟携邪斜胁谐写械卸蟹懈泄泻谢屑偕亵勰燮薤撷獬廨渫瀣邂绁缬榭榍躞" },
+    { "xin", u8"薪芯锌欣辛新忻心信衅囟馨忄昕歆鑫" },
+    { "xing", u8"星腥猩惺兴刑型形邢行醒幸杏性姓陉荇荥擤悻硎" },
+    { "xiong", u8"兄凶胸匈汹雄熊" },
+    { "xiu", u8"休修羞朽嗅锈秀袖绣咻岫馐庥溴鸺貅髹" },
+    { "xu", u8"墟戌需虚嘘须徐许蓄酗叙旭序恤絮婿绪续吁诩勖蓿洫溆顼栩煦盱胥糈醑" },
+    { "xuan", u8"轩喧宣悬旋玄选癣眩绚儇谖萱揎泫渲漩璇楦暄炫煊碹铉镟痃" },
+    { "xue", u8"削靴薛学穴雪血谑泶踅鳕" },
+    { "xun", u8"勋熏循旬询寻驯巡殉汛训讯逊迅巽埙荀荨蕈薰峋徇獯恂洵浔曛窨醺鲟" },
+    { "ya", u8"压押鸦鸭呀丫芽牙蚜崖衙涯雅哑亚讶轧伢垭揠吖岈迓娅琊桠氩砑睚痖" },
+    { "yan", u8"焉咽阉烟淹盐严研蜒岩延言颜阎炎沿奄掩眼衍演艳堰燕厌砚雁唁彦焰宴谚验厣赝俨偃兖讠谳郾鄢芫菸崦恹闫湮滟妍嫣琰檐晏胭腌焱罨筵酽魇餍鼹" },
+    { "yang", u8"殃央鸯秧杨扬佯疡羊洋阳氧仰痒养样漾徉怏泱炀烊恙蛘鞅" },
+    { "yao", u8"邀腰妖瑶摇尧遥窑谣姚咬舀药要耀钥夭爻吆崾徭幺珧杳轺曜肴鹞窈繇鳐" },
+    { "ye", u8"椰噎耶爷野冶也页掖业叶曳腋夜液靥谒邺揶晔烨铘" },
+    { "yi", u8"一壹医揖铱依伊衣颐夷遗移仪胰疑沂宜姨彝椅蚁倚已乙矣以艺抑易邑屹亿役臆逸肄疫亦裔意毅忆义益溢诣议谊译异翼翌绎刈劓佚佾诒圯埸懿苡薏弈奕挹弋呓咦咿噫峄嶷猗饴怿怡悒漪迤驿缢殪轶贻欹旖熠眙钇镒镱痍瘗癔翊衤蜴舣羿翳酏黟" },
+    { "yin", u8"茵荫因殷音阴姻吟银淫寅饮尹引隐印胤鄞廴垠堙茚吲喑狺夤洇氤铟瘾蚓霪" },
+    { "ying", u8"英樱婴鹰应缨莹萤营荧蝇迎赢盈影颖硬映嬴郢茔莺萦蓥撄嘤膺滢潆瀛瑛璎楹媵鹦瘿颍罂" },
+    { "yo", u8"哟唷" },
+    { "yong", u8"拥佣臃痈庸雍踊蛹咏泳涌永恿勇用俑壅墉喁慵邕镛甬鳙饔" },
+    { "you", u8"幽优悠忧尤由邮铀犹油游酉有友右佑釉诱又幼卣攸侑莠莜莸尢呦囿宥柚猷牖铕疣蚰蚴蝣鱿黝鼬" },
+    { "yu", u8"迂淤于盂榆虞愚舆余俞逾鱼愉渝渔隅予娱雨与屿禹宇语羽玉域芋郁遇喻峪御愈欲狱育誉浴寓裕预豫驭禺毓伛俣谀谕萸蓣揄圄圉嵛狳饫馀庾阈鬻妪妤纡瑜昱觎腴欤於煜燠肀聿钰鹆鹬瘐瘀窬窳蜮蝓竽臾舁雩龉" },
+    { "yuan", u8"鸳渊冤元垣袁原援辕园员圆猿源缘远苑愿怨院垸塬掾沅媛瑗橼爰眢鸢螈箢鼋" },
+    { "yue", u8"曰约越跃岳粤月悦阅龠瀹樾刖钺" },
+    { "yun", u8"耘云郧匀陨允运蕴酝晕韵孕郓芸狁恽愠纭韫殒昀氲熨筠" },
+    { "za", u8"匝砸杂咋拶咂" },
+    { "zai", u8"栽哉灾宰载再在崽甾" },
+    { "zan", u8"咱攒暂赞瓒昝簪糌趱錾" },
+    { "zang", u8"赃脏葬奘驵臧" },
+    { "zao", u8"遭糟凿藻枣早澡蚤躁噪造皂灶燥唣" },
+    { "ze", u8"责择则泽仄赜啧帻迮昃笮箦舴" },
+    { "zei", u8"贼" },
+    { "zen", u8"怎谮" },
+    { "zeng", u8"增憎赠缯甑罾锃" },
+    { "zha", u8"扎喳渣札铡闸眨栅榨乍炸诈柞揸吒咤哳楂砟痄蚱齄" },
+    { "zhai", u8"摘斋宅窄债寨砦瘵" },
+    { "zhan", u8"瞻毡詹粘沾盏斩崭展蘸栈占战站湛绽谵搌旃" },
+    { "zhang", u8"长樟章彰漳张掌涨杖丈帐账仗胀瘴障仉鄣幛嶂獐嫜璋蟑" },
+    { "zhao", u8"招昭找沼赵照罩兆肇召爪诏啁棹钊笊" },
+    { "zhe", u8"遮折哲蛰辙者锗蔗这浙著着谪摺柘辄磔鹧褶蜇赭" },
+    { "zhen", u8"珍斟真甄砧臻贞针侦枕疹诊震振镇阵圳蓁浈缜桢榛轸赈胗朕祯畛稹鸩箴" },
+    { "zheng", u8"蒸挣睁征狰争怔整拯正政帧症郑证诤峥钲铮筝" },
+    { "zhi", u8"芝枝支吱蜘知肢脂汁之织职直植殖执值侄址指止趾只旨纸志挚掷至致置帜峙制智秩稚质炙痔滞治窒卮陟郅埴芷摭帙徵夂忮彘咫骘栉枳栀桎轵轾贽胝膣祉祗黹雉鸷痣蛭絷酯跖踬踯豸觯" },
+    { "zhong", u8"中盅忠钟衷终种肿重仲众冢锺螽舯踵" },
+    { "zhou", u8"舟周州洲诌粥轴肘帚咒皱宙昼骤荮妯纣绉胄籀酎" },
+    { "zhu", u8"珠株蛛朱猪诸诛逐竹烛煮拄瞩嘱主柱助蛀贮铸筑住注祝驻丶伫侏邾苎茱洙渚潴杼槠橥炷铢疰瘃竺箸舳翥躅麈" },
+    { "zhua", u8"抓" },
+    { "zhuai", u8"拽" },
+    { "zhuan", u8"专砖转撰赚篆啭馔颛" },
+    { "zhuang", u8"桩庄装妆撞壮状" },
+    { "zhui", u8"锥追赘坠缀惴骓缒隹" },
+    { "zhun", u8"谆准肫窀" },
+    { "zhuo", u8"捉拙卓桌茁酌啄灼浊倬诼擢浞涿濯禚斫镯" },
+    { "zi", u8"兹咨资姿滋淄孜紫仔籽滓子自渍字谘嵫姊孳缁梓辎赀恣眦锱秭耔笫粢趑觜訾龇鲻髭" },
+    { "zong", u8"鬃棕踪宗综总纵偬腙粽" },
+    { "zou", u8"邹走奏揍诹陬鄹驺楱鲰" },
+    { "zu", u8"租足卒族祖诅阻组俎镞" },
+    { "zuan", u8"钻纂攥缵躜" },
+    { "zui", u8"嘴醉最罪蕞" },
+    { "zun", u8"尊遵撙樽鳟" },
+    { "zuo", u8"琢昨左佐做作坐座阼唑怍胙祚" },
+};
+const int kPinyinCount = int(sizeof(kPinyin) / sizeof(kPinyin[0]));
+
+// 两个字符串逐字对应
+const char kTraditional[] =
+    u8"丟並乾亂亙亞佇佈佔併來侖侶侷俁係俔俠俬俱倀倆倉個們倖倣倫偉側偵偽"
+    u8"傑傖傘備傢傭傯傳傴債傷傾僂僅僇僉僑僕僥僨僱價儀儂億儈儉儐儔儕儘償"
+    u8"優儲儷儸儺儻儼兇兌兒兗內兩冊冪凈凍凜凱別刪剄則剋剎剛剝剮剴創剷劃"
+    u8"劇劉劊劌劍劑勁動勗務勛勝勞勢勩勱勳勵勸勻匭匯匱區協卹卻厙厭厲厴參"
+    u8"叢吒吳吶呂咷咼員唄唚唸問啞啟啢喎喚喨喪喫喬單喲嗆嗇嗊嗎嗚嗩嗶嘆嘍"
+    u8"嘔嘖嘗嘜嘩嘮嘯嘰嘵嘸嘽噓噚噠噥噦噯噲噴噸噹嚀嚇嚌嚐嚕嚙嚥嚦嚨嚮嚲"
+    u8"嚳嚴嚶囀囁囂囅囈囉囍囑囓囪圇國圍園圓圖團垵埡埰執堅堊堝堯報場塊塋"
+    u8"塏塒塗塚塢塤塵塹墊墜墮墳墾壇壎壓壘壙壚壞壟壢壩壯壺壼壽夠夢夥夾奐"
+    u8"奧奩奪奮奼妝姊姍姦姪娛婁婦婭媧媯媼媽嫋嫗嫵嫻嫿嬈嬋嬌嬙嬝嬡嬤嬪嬰"
+    u8"嬸孃孌孫學孿宮寢實寧審寫寬寵寶將專尋對導尷屆屍屜屢層屨屬岡峴島峽"
+    u8"崍崑崗崙崢嵐嶁嶄嶇嶔嶗嶠嶢嶧嶮嶴嶸嶺嶼巋巒巔巖巰帥師帳帶幀幃幗幘"
+    u8"幟幣幫幬幹幾庫廁廂廄廈廚廝廟廠廡廢廣廩廬廳弒弔弳張強彆彈彌彎彙彥"
+    u8"彿後徑從徠復徬徵徹恆恥悅悵悶悽惡惱惲惻愛愜愨愴愷愾慄慇態慍慘慚慟"
+    u8"慣慪慫慮慳慶慼慾憂憊憐憑憒憚憤憫憮憲憶懃懇應懌懍懞懟懣懨懮懲懶懷"
+    u8"懸懺懼懾戀戇戔戧戩戰戲戶拋挩挾捨捫捲掃掄掗掙掛採揀揚換揮搆損搖搗"
+    u8"搥搧搨搵搶搾摀摑摜摟摯摳摶摺摻撈撏撐撓撚撝撟撢撣撥撫撲撳撻撾撿擁"
+    u8"擄擇擊擋擔據擠擣擬擯擰擱擲擴擷擺擻擼擾攄攆攏攔攖攙攛攜攝攢攣攤攪"
+    u8"攬敗敘敵數斂斃斕斬斷於昇時晉晝暈暉暘暢暫暱曄曆曇曉曏曖曠曨曬書會"
+    u8"朧東枒柵桿梔條梟梲棄棖棗棟棧棲棶椏楊楓楨業極榖榪榮榿構槍槓槤槧槨"
+    u8"槳樁樂樅樑樓標樞樣樸樹樺橈橋機橢橫檁檉檔檜檟檢檣檮檯檳檸檻櫃櫓櫚"
+    u8"櫛櫝櫞櫟櫥櫧櫨櫪櫫櫬櫱櫳櫸櫺櫻欄權欏欒欖欞欽歎歐歛歟歡歲歷歸歿殘"
+    u8"殞殤殫殮殯殰殲殺殼毀毆毬毿氂氈氌氣氫氬氳氾汎汙決沍沒沖況洩洶浹涇"
+    u8"涼淒淚淥淨淪淵淶淺渙減渦測渾湊湞湧湯溈準溝溫溼滄滅滌滎滬滯滲滷滸"
+    u8"滻滾滿漁漚漢漣漬漲漵漸漿潁潑潔潛潤潯潰潷潿澀澆澇澗澠澤澦澩澮澱濁"
+    u8"濃濕濘濟濤濫濬濰濱濺濼濾瀅瀆瀇瀉瀋瀏瀕瀘瀝瀟瀠瀦瀧瀨瀰瀲瀾灃灄灑"
+    u8"灕灘灝灠灣灤災為烏烴無煉煒煙煢煥煩煬熅熒熗熱熲熾燁燄燈燉燐燒燙燜"
+    u8"營燦燬燭燴燻燼燾燿爍爐爛爭爺爾牆牋牘牽犖犢犧狀狹狽猙猶猻獃獄獅獎"
+    u8"獨獪獫獮獰獲獵獷獸獺獻獼玀現琺琿瑋瑒瑣瑤瑩瑪瑯瑲璉璣璦璫環璽瓊瓏"
+    u8"瓔瓚甌甕產畝畢畫異當疇疊痀痙痠痾瘋瘍瘓瘞瘡瘧瘲瘺療癆癇癉癒癘癟癡"
+    u8"癢癤癥癩癬癭癮癰癱癲發皁皚皰皸皺盃盜盞盡監盤盧盪眥眾睏睜睞睪瞇瞜"
+    u8"瞞瞭瞶瞼矓矚矯砲硜硤硨硯碩碭確碼磑磚磣磧磯磽礎礙礡礦礪礫礬礱祕祿"
+    u8"禍禎禕禡禦禪禮禰禱禿秈稅稈稜稟種稱穀穌積穎穠穡穢穩穫穭窩窪窮窯窵"
+    u8"窶窺竄竅竇竊競筆筍筧筴箇箋箎箏箝節範築篋篔篤篩篳簀簆簍簞簡簣簫簷"
+    u8"簹簽簾籃籌籐籙籜籟籠籤籩籪籬籮籲粵糝糞糧糰糲糴糶糾紀紂約紅紆紇紈"
+    u8"紉紋納紐紓純紕紖紗紘紙級紛紜紝紡紬紮細紱紲紳紵紹紺紼紿絀終絃組絅"
+    u8"絆絎結絕絛絞絡絢給絨絰統絲絳絹綁綃綆綈綌綏綑經綜綞綠綢綣綬維綯綰"
+    u8"綱網綴綵綸綹綺綻綽綾綿緄緇緊緋緒緗緘緙線緝緞締緡緣緦編緩緬緯緱緲"
+    u8"練緶緹緻縈縉縊縋縐縑縕縗縛縝縞縟縣縫縭縮縱縲縳縴縵縶縷縹總績繃繅"
+    u8"繆繒織繕繚繞繡繢繩繪繫繭繯繰繳繸繹繼繽繾纈纊續纍纏纓纔纖纘纜缽罈"
+    u8"罌罣罰罵罷羅羆羈羋羥羨義羶習翫翹耬聖聞聯聰聲聳聵聶職聹聽聾肅脅脈"
+    u8"脛脣脫脹腎腡腦腫腳腸膃膚膠膩膽膾膿臉臍臏臘臚臟臠臢臥臨臺與興舉舊"
+    u8"舖艙艤艦艫艱艷芻苧茲荊荳莊莖莢莧華菸萇萊萬萵葉葒著葦葯葷蒐蒔蒞蒼"
+    u8"蓀蓆蓋蓮蓯蓽蔔蔞蔣蔥蔦蔭蕁蕆蕎蕓蕕蕘蕢蕩蕪蕭蕷薀薈薊薌薑薔薘薟薦"
+    u8"薩薳薴薺藉藍藎藝藥藪藶藷藹藺蘄蘆蘇蘊蘋蘚蘞蘢蘭蘺蘿虆處虛虜號虧虯"
+    u8"蛺蛻蜆蝕蝟蝦蝨蝸螄螞螢螮螻螿蟄蟈蟣蟬蟯蟲蟶蟻蠅蠆蠍蠐蠑蠔蠟蠣蠨蠱"
+    u8"蠶蠻衊術衚衛衝袞裊補裝裡製複褌褘褲褳褸褻襏襖襝襠襤襪襬襯襲覈見規"
+    u8"覓視覘覡覦親覬覯覲覷覺覽覿觀觴觶觸訂訃計訊訌討訐訒訓訕訖託記訛訝"
+    u8"訟訢訣訥訪設許訴訶診註証詁詆詎詐詒詔評詖詗詘詛詞詠詡詢詣試詩詫詬"
+    u8"詭詮詰話該詳詵詼詿誄誅誆誇誌認誑誒誕誘誚語誠誡誣誤誥誦誨說誰課誶"
+    u8"誹誼誾調諂諄談諉請諍諏諑諒論諗諛諜諝諞諡諢諤諦諧諫諭諮諱諳諶諷諸"
+    u8"諺諼諾謀謁謂謄謅謊謎謐謔謖謗謙謚講謝謠謨謫謬謳謹謾譁譅證譎譏譖識"
+    u8"譙譚譜譟譫譯議譴護譸譽譾讀變讌讎讒讓讕讖讚讜讞豈豎豐豔豬豶貍貓貙"
+    u8"貝貞負財貢貧貨販貪貫責貯貰貲貳貴貶買貸貺費貼貽貿賀賁賂賃賄賅資賈"
+    u8"賊賑賒賓賕賙賚賜賞賠賡賢賣賤賦賧質賬賭賰賴賵賸賺賻購賽賾贄贅贇贈"
+    u8"贊贍贏贐贓贔贖贗贛赬趕趙趨趲跡跤跼踐踡踰踴蹌蹕蹟蹣蹤蹧蹺躂躉躊躋"
+    u8"躍躑躒躓躕躚躡躥躦躪軀車軋軌軍軑軒軔軛軟軫軸軹軺軻軼軾較輅輇輈載"
+    u8"輊輒輓輔輕輛輜輝輞輟輥輦輩輪輬輯輳輸輻輾輿轀轂轄轅轆轉轍轎轔轝轟"
+    u8"轡轢轤辦辭辮辯農迴逕這連週進遊運過達違遙遜遞遠適遯遲遷選遺遼邁還"
+    u8"邇邊邏邐郟郵鄆鄉鄒鄔鄖鄧鄭鄰鄲鄴鄶鄺酇酈醃醜醞醫醬醱醼釀釁釃釅釋"
+    u8"釐釓釔釕釗釘釙針釣釤釦釧釩釵釷釹鈀鈁鈃鈄鈉鈍鈐鈑鈒鈔鈕鈞鈣鈥鈦鈧"
+    u8"鈮鈰鈳鈴鈷鈸鈹鈺鈽鈾鈿鉀鉅鉈鉉鉋鉍鉑鉗鉚鉛鉞鉤鉦鉬鉭鉶鉸鉺鉻鉿銀"
+    u8"銃銅銍銑銓銖銘銚銛銜銠銣銥銦銨銩銪銫銬銲銳銷銻銼鋁鋃鋅鋇鋌鋏鋒鋙"
+    u8"鋝鋟鋤鋦鋨鋩鋪鋮鋯鋰鋱鋸鋼錁錄錆錈錏錐錒錕錘錙錚錛錟錠錡錢錦錨錩"
+    u8"錫錮錯錳錶錸鍆鍇鍊鍋鍍鍔鍘鍚鍛鍠鍤鍥鍬鍰鍵鍶鍺鍾鎂鎊鎔鎖鎗鎘鎚鎛"
+    u8"鎡鎢鎣鎦鎧鎩鎪鎬鎮鎰鎲鎳鎵鏃鏇鏈鏌鏍鏐鏑鏗鏘鏜鏝鏞鏟鏡鏢鏤鏨鏵鏷"
+    u8"鏹鏽鐃鐋鐐鐒鐓鐔鐘鐙鐠鐨鐫鐮鐲鐳鐵鐶鐸鐺鐿鑄鑊鑌鑑鑒鑕鑞鑠鑣鑭鑰"
+    u8"鑱鑲鑷鑼鑽鑾鑿钁長門閂閃閆閈閉開閌閎閏閑閒間閔閘閡閣閥閨閩閫閬閭"
+    u8"閱閶閹閻閼閽閾閿闃闆闇闈闊闋闌闍闐闒闓闔闕闖關闞闠闡闢闤闥阨阪陘"
+    u8"陝陞陣陰陳陸陽隄隉隊階隕際隨險隱隴隸隻雋雖雙雛雜雞離難雲電霑霢霧"
+    u8"霽靂靄靈靚靜靦靨靷鞀鞏鞝韁韃韉韋韌韍韓韙韜韞韻響頁頂頃項順頇須頊"
+    u8"頌頎頏預頑頒頓頗領頜頡頤頦頭頰頲頷頸頹頻顆題額顎顏顒顓願顙顛類顢"
+    u8"顥顧顫顯顰顱顳顴風颭颮颯颱颳颶颸颺颻颼飀飄飆飛飢飣飥飩飪飫飭飯飲"
+    u8"飴飼飽飾餃餅餉養餌餑餒餓餕餖餘餚餛餞餡館餬餱餳餵餺餼餽餾餿饁饃饅"
+    u8"饈饉饋饌饑饒饗饜饞馬馭馮馱馳馴馹駁駐駑駒駔駕駘駙駛駝駟駢駭駰駱駸"
+    u8"駿騁騂騅騍騎騏騖騙騤騧騫騭騮騰騶騷騸騾驀驁驂驃驄驅驊驌驍驏驕驗驚"
+    u8"驛驟驢驤驥驦驪驫骯髏髒體髕髖髮鬆鬍鬚鬢鬥鬧鬨鬩鬮鬱魎魘魚魛魨魯魴"
+    u8"魷魺鮐鮑鮒鮓鮚鮞鮦鮪鮫鮭鮮鮶鯀鯁鯇鯉鯊鯔鯕鯖鯛鯡鯢鯤鯧鯨鯪鯫鯰鯷"
+    u8"鯽鰈鰉鰍鰒鰓鰜鰣鰥鰨鰩鰭鰱鰲鰳鰷鰹鰻鰼鰾鱈鱉鱒鱔鱖鱗鱘鱟鱠鱣鱧鱨"
+    u8"鱭鱷鱸鱺鳥鳧鳩鳲鳳鳴鳶鴆鴇鴉鴒鴕鴛鴝鴞鴟鴣鴦鴨鴯鴰鴷鴻鴿鵁鵂鵃鵑"
+    u8"鵒鵓鵜鵝鵠鵡鵪鵬鵯鵲鵷鶄鶇鶉鶊鶖鶘鶚鶡鶩鶪鶬鶯鶲鶴鶹鶺鶻鶼鷁鷂鷈"
+    u8"鷊鷓鷖鷗鷙鷚鷥鷦鷫鷯鷲鷳鷸鷹鷺鷽鷿鸂鸇鸏鸕鸚鸛鸝鸞鹵鹹鹺鹼鹽麗麤"
+    u8"麥麩麵麼黃黌點黨黲黴黶黷黽黿鼇鼉鼕鼴齊齋齎齏齒齔齕齗齙齜齟齠齡齣"
+    u8"齦齧齪齬齲齶齷龍龐龔龕龜";
+const char kSimplified[] =
+    u8"丢并干乱亘亚伫布占并来仑侣局俣系伣侠私具伥俩仓个们幸仿伦伟侧侦伪"
+    u8"杰伧伞备家佣偬传伛债伤倾偻仅戮佥侨仆侥偾雇价仪侬亿侩俭傧俦侪尽偿"
+    u8"优储俪㑩傩傥俨凶兑儿兖内两册幂净冻凛凯别删刭则克刹刚剥剐剀创铲划"
+    u8"剧刘刽刿剑剂劲动勖务勋胜劳势勚劢勋励劝匀匦汇匮区协恤却厍厌厉厣参"
+    u8"丛咤吴呐吕啕呙员呗吣念问哑启唡㖞唤亮丧吃乔单哟呛啬唝吗呜唢哔叹喽"
+    u8"呕啧尝唛哗唠啸叽哓呒啴嘘㖊哒哝哕嗳哙喷吨当咛吓哜尝噜啮咽呖咙向亸"
+    u8"喾严嘤啭嗫嚣冁呓啰禧嘱啮囱囵国围园圆图团埯垭采执坚垩埚尧报场块茔"
+    u8"垲埘涂冢坞埙尘堑垫坠堕坟垦坛埙压垒圹垆坏垄坜坝壮壶壸寿够梦伙夹奂"
+    u8"奥奁夺奋姹妆姐姗奸侄娱娄妇娅娲妫媪妈袅妪妩娴婳娆婵娇嫱袅嫒嬷嫔婴"
+    u8"婶娘娈孙学孪宫寝实宁审写宽宠宝将专寻对导尴届尸屉屡层屦属冈岘岛峡"
+    u8"崃昆岗仑峥岚嵝崭岖嵚崂峤峣峄崄岙嵘岭屿岿峦巅岩巯帅师帐带帧帏帼帻"
+    u8"帜币帮帱干几库厕厢厩厦厨厮庙厂庑废广廪庐厅弑吊弪张强别弹弥弯汇彦"
+    u8"佛后径从徕复彷征彻恒耻悦怅闷凄恶恼恽恻爱惬悫怆恺忾栗殷态愠惨惭恸"
+    u8"惯怄怂虑悭庆戚欲忧惫怜凭愦惮愤悯怃宪忆勤恳应怿懔蒙怼懑恹忧惩懒怀"
+    u8"悬忏惧慑恋戆戋戗戬战戏户抛捝挟舍扪卷扫抡挜挣挂采拣扬换挥构损摇捣"
+    u8"捶扇拓揾抢榨捂掴掼搂挚抠抟折掺捞挦撑挠捻㧑挢掸掸拨抚扑揿挞挝捡拥"
+    u8"掳择击挡担据挤捣拟摈拧搁掷扩撷摆擞撸扰摅撵拢拦撄搀撺携摄攒挛摊搅"
+    u8"揽败叙敌数敛毙斓斩断于升时晋昼晕晖旸畅暂昵晔历昙晓向暧旷昽晒书会"
+    u8"胧东丫栅杆栀条枭棁弃枨枣栋栈栖梾桠杨枫桢业极谷杩荣桤构枪杠梿椠椁"
+    u8"桨桩乐枞梁楼标枢样朴树桦桡桥机椭横檩柽档桧槚检樯梼台槟柠槛柜橹榈"
+    u8"栉椟橼栎橱槠栌枥橥榇蘖栊榉棂樱栏权椤栾榄棂钦叹欧敛欤欢岁历归殁残"
+    u8"殒殇殚殓殡㱩歼杀壳毁殴球毵牦毡氇气氢氩氲泛泛污决冱没冲况泄汹浃泾"
+    u8"凉凄泪渌净沦渊涞浅涣减涡测浑凑浈涌汤沩准沟温湿沧灭涤荥沪滞渗卤浒"
+    u8"浐滚满渔沤汉涟渍涨溆渐浆颍泼洁潜润浔溃滗涠涩浇涝涧渑泽滪泶浍淀浊"
+    u8"浓湿泞济涛滥浚潍滨溅泺滤滢渎㲿泻沈浏濒泸沥潇潆潴泷濑弥潋澜沣滠洒"
+    u8"漓滩灏漤湾滦灾为乌烃无炼炜烟茕焕烦炀煴荧炝热颎炽烨焰灯炖磷烧烫焖"
+    u8"营灿毁烛烩熏烬焘耀烁炉烂争爷尔墙笺牍牵荦犊牺状狭狈狰犹狲呆狱狮奖"
+    u8"独狯猃狝狞获猎犷兽獭献猕猡现珐珲玮玚琐瑶莹玛琅玱琏玑瑷珰环玺琼珑"
+    u8"璎瓒瓯瓮产亩毕画异当畴叠佝痉酸疴疯疡痪瘗疮疟疭瘘疗痨痫瘅愈疠瘪痴"
+    u8"痒疖症癞癣瘿瘾痈瘫癫发皂皑疱皲皱杯盗盏尽监盘卢荡眦众困睁睐睾眯䁖"
+    u8"瞒了瞆睑眬瞩矫炮硁硖砗砚硕砀确码硙砖碜碛矶硗础碍礴矿砺砾矾砻秘禄"
+    u8"祸祯祎祃御禅礼祢祷秃籼税秆棱禀种称谷稣积颖秾穑秽稳获稆窝洼穷窑窎"
+    u8"窭窥窜窍窦窃竞笔笋笕䇲个笺篪筝钳节范筑箧筼笃筛筚箦筘篓箪简篑箫檐"
+    u8"筜签帘篮筹藤箓箨籁笼签笾簖篱箩吁粤糁粪粮团粝籴粜纠纪纣约红纡纥纨"
+    u8"纫纹纳纽纾纯纰纼纱纮纸级纷纭纴纺䌷扎细绂绁绅纻绍绀绋绐绌终弦组䌹"
+    u8"绊绗结绝绦绞络绚给绒绖统丝绛绢绑绡绠绨绤绥捆经综缍绿绸绻绶维绹绾"
+    u8"纲网缀彩纶绺绮绽绰绫绵绲缁紧绯绪缃缄缂线缉缎缔缗缘缌编缓缅纬缑缈"
+    u8"练缏缇致萦缙缢缒绉缣缊缞缚缜缟缛县缝缡缩纵缧䌸纤缦絷缕缥总绩绷缫"
+    u8"缪缯织缮缭绕绣缋绳绘系茧缳缲缴䍁绎继缤缱缬纩续累缠缨才纤缵缆钵坛"
+    u8"罂挂罚骂罢罗罴羁芈羟羡义膻习玩翘耧圣闻联聪声耸聩聂职聍听聋肃胁脉"
+    u8"胫唇脱胀肾脶脑肿脚肠腽肤胶腻胆脍脓脸脐膑腊胪脏脔臜卧临台与兴举旧"
+    u8"铺舱舣舰舻艰艳刍苎兹荆豆庄茎荚苋华烟苌莱万莴叶荭着苇药荤搜莳莅苍"
+    u8"荪席盖莲苁荜卜蒌蒋葱茑荫荨蒇荞芸莸荛蒉荡芜萧蓣蕰荟蓟芗姜蔷荙莶荐"
+    u8"萨䓕苧荠借蓝荩艺药薮苈薯蔼蔺蕲芦苏蕴苹藓蔹茏兰蓠萝蔂处虚虏号亏虬"
+    u8"蛱蜕蚬蚀猬虾虱蜗蛳蚂萤䗖蝼螀蛰蝈虮蝉蛲虫蛏蚁蝇虿蝎蛴蝾蚝蜡蛎蟏蛊"
+    u8"蚕蛮蔑术胡卫冲衮袅补装里制复裈袆裤裢褛亵袯袄裣裆褴袜䙓衬袭核见规"
+    u8"觅视觇觋觎亲觊觏觐觑觉览觌观觞觯触订讣计讯讧讨讦讱训讪讫托记讹讶"
+    u8"讼䜣诀讷访设许诉诃诊注证诂诋讵诈诒诏评诐诇诎诅词咏诩询诣试诗诧诟"
+    u8"诡诠诘话该详诜诙诖诔诛诓夸志认诳诶诞诱诮语诚诫诬误诰诵诲说谁课谇"
+    u8"诽谊訚调谄谆谈诿请诤诹诼谅论谂谀谍谞谝谥诨谔谛谐谏谕谘讳谙谌讽诸"
+    u8"谚谖诺谋谒谓誊诌谎谜谧谑谡谤谦谥讲谢谣谟谪谬讴谨谩哗䜧证谲讥谮识"
+    u8"谯谭谱噪谵译议谴护诪誉谫读变䜩雠谗让谰谶赞谠谳岂竖丰艳猪豮狸猫䝙"
+    u8"贝贞负财贡贫货贩贪贯责贮贳赀贰贵贬买贷贶费贴贻贸贺贲赂赁贿赅资贾"
+    u8"贼赈赊宾赇赒赉赐赏赔赓贤卖贱赋赕质账赌䞐赖赗剩赚赙购赛赜贽赘赟赠"
+    u8"赞赡赢赆赃赑赎赝赣赪赶赵趋趱迹交局践蜷逾踊跄跸迹蹒踪糟跷跶趸踌跻"
+    u8"跃踯跞踬蹰跹蹑蹿躜躏躯车轧轨军轪轩轫轭软轸轴轵轺轲轶轼较辂辁辀载"
+    u8"轾辄挽辅轻辆辎辉辋辍辊辇辈轮辌辑辏输辐辗舆辒毂辖辕辘转辙轿辚舆轰"
+    u8"辔轹轳办辞辫辩农回迳这连周进游运过达违遥逊递远适遁迟迁选遗辽迈还"
+    u8"迩边逻逦郏邮郓乡邹邬郧邓郑邻郸邺郐邝酂郦腌丑酝医酱酦宴酿衅酾酽释"
+    u8"厘钆钇钌钊钉钋针钓钐扣钏钒钗钍钕钯钫钘钭钠钝钤钣钑钞钮钧钙钬钛钪"
+    u8"铌铈钶铃钴钹铍钰钸铀钿钾钜铊铉铇铋铂钳铆铅钺钩钲钼钽铏铰铒铬铪银"
+    u8"铳铜铚铣铨铢铭铫铦衔铑铷铱铟铵铥铕铯铐焊锐销锑锉铝锒锌钡铤铗锋铻"
+    u8"锊锓锄锔锇铓铺铖锆锂铽锯钢锞录锖锩铔锥锕锟锤锱铮锛锬锭锜钱锦锚锠"
+    u8"锡锢错锰表铼钔锴炼锅镀锷铡钖锻锽锸锲锹锾键锶锗钟镁镑镕锁枪镉锤镈"
+    u8"镃钨蓥镏铠铩锼镐镇镒镋镍镓镞镟链镆镙镠镝铿锵镗镘镛铲镜镖镂錾铧镤"
+    u8"镪锈铙铴镣铹镦镡钟镫镨镄镌镰镯镭铁镮铎铛镱铸镬镔鉴鉴锧镴铄镳镧钥"
+    u8"镵镶镊锣钻銮凿䦆长门闩闪闫闬闭开闶闳闰闲闲间闵闸阂阁阀闺闽阃阆闾"
+    u8"阅阊阉阎阏阍阈阌阒板暗闱阔阕阑阇阗阘闿阖阙闯关阚阓阐辟阛闼厄坂陉"
+    u8"陕升阵阴陈陆阳堤陧队阶陨际随险隐陇隶只隽虽双雏杂鸡离难云电沾霡雾"
+    u8"霁雳霭灵靓静腼靥纼鼗巩绱缰鞑鞯韦韧韨韩韪韬韫韵响页顶顷项顺顸须顼"
+    u8"颂颀颃预顽颁顿颇领颌颉颐颏头颊颋颔颈颓频颗题额颚颜颙颛愿颡颠类颟"
+    u8"颢顾颤显颦颅颞颧风飐飑飒台刮飓飔飏飖飕飗飘飙飞饥饤饦饨饪饫饬饭饮"
+    u8"饴饲饱饰饺饼饷养饵饽馁饿馂饾余肴馄饯馅馆糊糇饧喂馎饩馈馏馊馌馍馒"
+    u8"馐馑馈馔饥饶飨餍馋马驭冯驮驰驯驲驳驻驽驹驵驾骀驸驶驼驷骈骇骃骆骎"
+    u8"骏骋骍骓骒骑骐骛骗骙䯄骞骘骝腾驺骚骟骡蓦骜骖骠骢驱骅骕骁骣骄验惊"
+    u8"驿骤驴骧骥骦骊骉肮髅脏体髌髋发松胡须鬓斗闹哄阋阄郁魉魇鱼鱽鲀鲁鲂"
+    u8"鱿鲄鲐鲍鲋鲊鲒鲕鲖鲔鲛鲑鲜鲪鲧鲠鲩鲤鲨鲻鲯鲭鲷鲱鲵鲲鲳鲸鲮鲰鲶鳀"
+    u8"鲫鲽鳇鳅鳆鳃鳒鲥鳏鳎鳐鳍鲢鳌鳓鲦鲣鳗鳛鳔鳕鳖鳟鳝鳜鳞鲟鲎鲙鳣鳢鲿"
+    u8"鲚鳄鲈鲡鸟凫鸠鸤凤鸣鸢鸩鸨鸦鸰鸵鸳鸲鸮鸱鸪鸯鸭鸸鸹䴕鸿鸽䴔鸺鸼鹃"
+    u8"鹆鹁鹈鹅鹄鹉鹌鹏鹎鹊鹓䴖鸫鹑鹒鹙鹕鹗鹖鹜䴗鸧莺鹟鹤鹠鹡鹘鹣鹢鹞䴘"
+    u8"鹝鹧鹥鸥鸷鹨鸶鹪鹔鹩鹫鹇鹬鹰鹭鸴䴙㶉鹯鹲鸬鹦鹳鹂鸾卤咸鹾碱盐丽粗"
+    u8"麦麸面么黄黉点党黪霉黡黩黾鼋鳌鼍冬鼹齐斋赍齑齿龀龁龂龅龇龃龆龄出"
+    u8"龈啮龊龉龋腭龌龙庞龚龛龟";
+
+} // namespace ChineseTextData
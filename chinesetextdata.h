@@ -0,0 +1,19 @@
+#ifndef CHINESETEXTDATA_H
+#define CHINESETEXTDATA_H
+
+// chinesetext.cpp 使用的本地对照表，数据见 chinesetextdata.cpp
+namespace ChineseTextData {
+
+struct PinyinEntry {
+    const char *syllable;     // 不带声调的小写拼音，ü 记作 u
+    const char *characters;   // 读这个音的汉字（UTF-8）
+};
+
+extern const PinyinEntry kPinyin[];
+extern const int kPinyinCount;
+extern const char kTraditional[];
+extern const char kSimplified[];
+
+} // namespace ChineseTextData
+
+#endif // CHINESETEXTDATA_H
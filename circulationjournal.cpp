@@ -0,0 +1,365 @@
+#include "circulationjournal.h"
+#include "checksum.h"
+
+#include <QSaveFile>
+#include <QtEndian>
+#include <cstring>
+#include <limits>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int kDefaultGroupCommitMs = 20;
+const int kMaxPendingBytes = 64 * 1024;     // 缓冲区超过该大小立即提交
+const int kEntryHeaderSize = 8;             // 负载长度 + CRC-32
+const quint32 kMaxPayloadSize = 16 * 1024 * 1024;
+const qint32 kNoDate = std::numeric_limits<qint32>::min();
+
+bool setError(QString *errorMessage, const QString &message)
+{
+    if (errorMessage) *errorMessage = message;
+    return false;
+}
+
+bool syncToDisk(QFile &file)
+{
+    if (!file.flush()) return false;
+#ifdef Q_OS_WIN
+    return _commit(file.handle()) == 0;
+#else
+    return ::fsync(file.handle()) == 0;
+#endif
+}
+
+// ---- 编码 ----
+
+template <typename T>
+void put(QByteArray &out, T v)
+{
+    uchar buf[sizeof(T)];
+    qToLittleEndian<T>(v, buf);
+    out.append(reinterpret_cast<const char *>(buf), int(sizeof(T)));
+}
+
+void putString(QByteArray &out, const QString &s)
+{
+    const QByteArray utf8 = s.toUtf8();
+    put<quint32>(out, quint32(utf8.size()));
+    out.append(utf8);
+}
+
+void putDate(QByteArray &out, const QDate &d)
+{
+    put<qint32>(out, d.isValid() ? qint32(d.toJulianDay()) : kNoDate);
+}
+
+void putBook(QByteArray &out, const Book &b)
+{
+    putString(out, b.indexId);
+    putString(out, b.name);
+    putString(out, b.location);
+    putString(out, b.category);
+    put<qint32>(out, b.quantity);
+    quint64 priceBits;
+    std::memcpy(&priceBits, &b.price, sizeof priceBits);
+    put<quint64>(out, priceBits);
+    putDate(out, b.inDate);
+    putDate(out, b.returnDate);
+    put<qint32>(out, b.borrowCount);
+    put<quint8>(out, b.available ? 1 : 0);
+}
+
+// ---- 解码 ----
+
+struct PayloadReader {
+    const uchar *p;
+    const uchar *end;
+    bool ok = true;
+
+    template <typename T>
+    T get()
+    {
+        if (end - p < qint64(sizeof(T))) {
+            ok = false;
+            return T();
+        }
+        const T v = qFromLittleEndian<T>(p);
+        p += sizeof(T);
+        return v;
+    }
+
+    QString getString()
+    {
+        const quint32 len = get<quint32>();
+        if (!ok || quint64(end - p) < len) {
+            ok = false;
+            return QString();
+        }
+        const QString s = QString::fromUtf8(reinterpret_cast<const char *>(p), int(len));
+        p += len;
+        return s;
+    }
+
+    QDate getDate()
+    {
+        const qint32 jd = get<qint32>();
+        return jd == kNoDate ? QDate() : QDate::fromJulianDay(jd);
+    }
+
+    Book getBook()
+    {
+        Book b;
+        b.indexId = getString();
+        b.name = getString();
+        b.location = getString();
+        b.category = getString();
+        b.quantity = get<qint32>();
+        const quint64 priceBits = get<quint64>();
+        std::memcpy(&b.price, &priceBits, sizeof priceBits);
+        b.inDate = getDate();
+        b.returnDate = getDate();
+        b.borrowCount = get<qint32>();
+        b.available = get<quint8>() != 0;
+        return b;
+    }
+};
+
+bool decodeEntry(const uchar *payload, quint32 size, CirculationJournal::Entry *e)
+{
+    PayloadReader r{ payload, payload + size };
+    e->sequence = r.get<quint64>();
+    const quint8 op = r.get<quint8>();
+    switch (op) {
+    case CirculationJournal::AddOperation:
+        e->book = r.getBook();
+        e->indexId = e->book.indexId;
+        break;
+    case CirculationJournal::UpdateOperation:
+        e->indexId = r.getString();
+        e->book = r.getBook();
+        break;
+    case CirculationJournal::RemoveOperation:
+    case CirculationJournal::ReturnOperation:
+        e->indexId = r.getString();
+        break;
+    case CirculationJournal::BorrowOperation:
+        e->indexId = r.getString();
+        e->dueDate = r.getDate();
+        break;
+    default:
+        return false;
+    }
+    e->operation = CirculationJournal::Operation(op);
+    return r.ok;
+}
+
+} // namespace
+
+CirculationJournal::CirculationJournal(QObject *parent)
+    : QObject(parent)
+{
+    commitTimer_.setSingleShot(true);
+    commitTimer_.setInterval(kDefaultGroupCommitMs);
+    connect(&commitTimer_, &QTimer::timeout, this, [this]() { sync(); });
+}
+
+CirculationJournal::~CirculationJournal()
+{
+    close();
+}
+
+bool CirculationJournal::open(const QString &filePath, quint64 afterSequence,
+                              const std::function<void(const Entry &)> &replay,
+                              int *replayedEntries, QString *errorMessage)
+{
+    close();
+    file_.setFileName(filePath);
+    if (!file_.open(QIODevice::ReadWrite)) {
+        return setError(errorMessage, QStringLiteral("无法打开借还日志: ") + filePath);
+    }
+
+    // 日志在每次检查点后清空，长度有上限，可以整体读入
+    const QByteArray data = file_.readAll();
+    const uchar *base = reinterpret_cast<const uchar *>(data.constData());
+    qint64 pos = 0;
+    int replayed = 0;
+    lastSequence_ = afterSequence;
+    entriesSinceReset_ = 0;
+    while (data.size() - pos >= kEntryHeaderSize) {
+        const quint32 size = qFromLittleEndian<quint32>(base + pos);
+        const quint32 crc = qFromLittleEndian<quint32>(base + pos + 4);
+        if (size > kMaxPayloadSize || data.size() - pos - kEntryHeaderSize < qint64(size)) break;
+        const uchar *payload = base + pos + kEntryHeaderSize;
+        if (crc32(payload, size) != crc) break;
+        Entry e;
+        if (!decodeEntry(payload, size, &e)) break;
+        pos += kEntryHeaderSize + size;
+        ++entriesSinceReset_;
+        if (e.sequence <= afterSequence) continue;   // 已包含在快照中
+        lastSequence_ = e.sequence;
+        if (replay) replay(e);
+        ++replayed;
+    }
+
+    // 截掉崩溃时写了一半的尾部记录，后续追加从最后一条完整记录之后开始
+    if (pos < data.size() && !file_.resize(pos)) {
+        close();
+        return setError(errorMessage, QStringLiteral("无法修复借还日志: ") + filePath);
+    }
+    file_.seek(pos);
+    if (replayedEntries) *replayedEntries = replayed;
+    return true;
+}
+
+void CirculationJournal::close()
+{
+    if (!file_.isOpen()) return;
+    sync();
+    file_.close();
+}
+
+bool CirculationJournal::isOpen() const
+{
+    return file_.isOpen();
+}
+
+void CirculationJournal::logAdd(const Book &book)
+{
+    append(AddOperation, book.indexId, &book, QDate());
+}
+
+void CirculationJournal::logUpdate(const QString &indexId, const Book &book)
+{
+    append(UpdateOperation, indexId, &book, QDate());
+}
+
+void CirculationJournal::logRemove(const QString &indexId)
+{
+    append(RemoveOperation, indexId, nullptr, QDate());
+}
+
+void CirculationJournal::logBorrow(const QString &indexId, const QDate &dueDate)
+{
+    append(BorrowOperation, indexId, nullptr, dueDate);
+}
+
+void CirculationJournal::logReturn(const QString &indexId)
+{
+    append(ReturnOperation, indexId, nullptr, QDate());
+}
+
+void CirculationJournal::append(Operation operation, const QString &indexId, const Book *book, const QDate &dueDate)
+{
+    if (!file_.isOpen()) return;
+
+    QByteArray payload;
+    put<quint64>(payload, ++lastSequence_);
+    put<quint8>(payload, operation);
+    switch (operation) {
+    case AddOperation:
+        putBook(payload, *book);
+        break;
+    case UpdateOperation:
+        putString(payload, indexId);
+        putBook(payload, *book);
+        break;
+    case RemoveOperation:
+    case ReturnOperation:
+        putString(payload, indexId);
+        break;
+    case BorrowOperation:
+        putString(payload, indexId);
+        putDate(payload, dueDate);
+        break;
+    }
+
+    put<quint32>(pending_, quint32(payload.size()));
+    put<quint32>(pending_, crc32(payload.constData(), payload.size()));
+    pending_.append(payload);
+    ++entriesSinceReset_;
+
+    if (pending_.size() >= kMaxPendingBytes) {
+        sync();
+    } else if (!commitTimer_.isActive()) {
+        commitTimer_.start();
+    }
+}
+
+bool CirculationJournal::sync()
+{
+    commitTimer_.stop();
+    if (pending_.isEmpty() || !file_.isOpen()) return true;
+    const bool ok = file_.write(pending_) == pending_.size() && syncToDisk(file_);
+    pending_.clear();
+    if (!ok) emit writeFailed(QStringLiteral("写入借还日志失败: ") + file_.errorString());
+    return ok;
+}
+
+bool CirculationJournal::reset(quint64 throughSequence)
+{
+    if (!file_.isOpen()) {
+        pending_.clear();
+        entriesSinceReset_ = 0;
+        return true;
+    }
+    // 待提交的记录先落盘，再与文件中已有的记录一起筛选
+    if (!sync()) return false;
+
+    // 序号递增，找到第一条比快照新的记录，其后全部保留
+    if (!file_.seek(0)) return false;
+    const QByteArray data = file_.readAll();
+    const uchar *base = reinterpret_cast<const uchar *>(data.constData());
+    qint64 pos = 0;
+    qint64 keepFrom = data.size();
+    int kept = 0;
+    while (data.size() - pos >= kEntryHeaderSize + qint64(sizeof(quint64))) {
+        const quint32 size = qFromLittleEndian<quint32>(base + pos);
+        const quint64 sequence = qFromLittleEndian<quint64>(base + pos + kEntryHeaderSize);
+        if (sequence > throughSequence) {
+            if (kept == 0) keepFrom = pos;
+            ++kept;
+        }
+        pos += kEntryHeaderSize + size;
+    }
+
+    bool ok;
+    if (kept == 0) {
+        ok = file_.resize(0) && file_.seek(0) && syncToDisk(file_);
+        if (!ok) emit writeFailed(QStringLiteral("清空借还日志失败: ") + file_.errorString());
+    } else {
+        const QString filePath = file_.fileName();
+        QSaveFile out(filePath);
+        ok = out.open(QIODevice::WriteOnly)
+            && out.write(data.constData() + keepFrom, data.size() - keepFrom) == data.size() - keepFrom;
+        // 先关闭原文件再替换（Windows 下无法替换仍打开着的文件），之后重新打开继续追加
+        file_.close();
+        ok = ok && out.commit();
+        if (!ok) emit writeFailed(QStringLiteral("截断借还日志失败: ") + out.errorString());
+        if (!file_.open(QIODevice::ReadWrite) || !file_.seek(file_.size())) {
+            emit writeFailed(QStringLiteral("无法重新打开借还日志: ") + filePath);
+            return false;
+        }
+    }
+    if (ok) entriesSinceReset_ = kept;
+    return ok;
+}
+
+quint64 CirculationJournal::lastSequence() const
+{
+    return lastSequence_;
+}
+
+int CirculationJournal::entriesSinceReset() const
+{
+    return entriesSinceReset_;
+}
+
+void CirculationJournal::setGroupCommitInterval(int msec)
+{
+    commitTimer_.setInterval(msec);
+}
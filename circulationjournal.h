@@ -0,0 +1,82 @@
+#ifndef CIRCULATIONJOURNAL_H
+#define CIRCULATIONJOURNAL_H
+
+#include <QObject>
+#include <QFile>
+#include <QTimer>
+#include <QByteArray>
+#include <QString>
+#include <QDate>
+#include <functional>
+
+#include "book.h"
+
+// 只追加的借还操作日志（预写日志）
+//
+// 每条记录格式：quint32 负载长度 + quint32 负载 CRC-32 + 负载，负载以递增的序号开头。
+// 一次借阅只追加几十个字节，不再重写整个目录文件。
+// 新记录先进入内存缓冲区，在组提交间隔到期或缓冲区写满时一次性写入并 fsync，
+// 多次借还共享一次刷盘；代价是崩溃时最多丢失最近一个间隔内的操作。
+// 检查点把当前目录写入快照（快照记录当时的最后序号）后丢弃不大于该序号的记录，
+// 写快照期间追加的记录保留下来；启动时只重放序号更大的记录。
+class CirculationJournal : public QObject {
+    Q_OBJECT
+public:
+    enum Operation : quint8 {
+        AddOperation = 1,
+        UpdateOperation = 2,
+        RemoveOperation = 3,
+        BorrowOperation = 4,
+        ReturnOperation = 5
+    };
+
+    struct Entry {
+        quint64 sequence = 0;
+        Operation operation = AddOperation;
+        QString indexId;    // 更新/删除/借阅/归还的目标索引号
+        Book book;          // 新增/更新后的图书
+        QDate dueDate;      // 借阅的归还日期
+    };
+
+    explicit CirculationJournal(QObject *parent = nullptr);
+    ~CirculationJournal() override;
+
+    // 打开（必要时创建）日志文件，把序号大于 afterSequence 的记录依次交给 replay。
+    // 尾部因崩溃写了一半的记录会被截掉。
+    bool open(const QString &filePath, quint64 afterSequence,
+              const std::function<void(const Entry &)> &replay,
+              int *replayedEntries = nullptr, QString *errorMessage = nullptr);
+    void close();
+    bool isOpen() const;
+
+    void logAdd(const Book &book);
+    void logUpdate(const QString &indexId, const Book &book);
+    void logRemove(const QString &indexId);
+    void logBorrow(const QString &indexId, const QDate &dueDate);
+    void logReturn(const QString &indexId);
+
+    // 立即写入并刷盘所有待提交记录
+    bool sync();
+    // 检查点快照写入成功后调用：丢弃序号不大于 throughSequence（已包含在快照中）的记录，
+    // 更新的记录原样保留。有保留时经 QSaveFile 整体替换日志文件，中途崩溃不会丢记录
+    bool reset(quint64 throughSequence);
+
+    quint64 lastSequence() const;
+    int entriesSinceReset() const;
+    void setGroupCommitInterval(int msec);
+
+signals:
+    void writeFailed(const QString &message);
+
+private:
+    void append(Operation operation, const QString &indexId, const Book *book, const QDate &dueDate);
+
+private:
+    QFile file_;
+    QByteArray pending_;
+    QTimer commitTimer_;
+    quint64 lastSequence_ = 0;
+    int entriesSinceReset_ = 0;
+};
+
+#endif // CIRCULATIONJOURNAL_H
@@ -0,0 +1,232 @@
+#include "columnkernels.h"
+
+#include <QtAlgorithms>
+
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COLUMNKERNELS_X86 1
+#include <immintrin.h>
+#define COLUMNKERNELS_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace ColumnKernels {
+
+namespace {
+
+// 最后一个字中属于有效行的位
+quint64 tailMask(int n)
+{
+    return n % 64 == 0 ? ~quint64(0) : (quint64(1) << (n % 64)) - 1;
+}
+
+template <typename T>
+quint64 scalarWord(const T *values, int count, T lo, T hi)
+{
+    quint64 word = 0;
+    for (int i = 0; i < count; ++i) {
+        if (values[i] >= lo && values[i] <= hi) word |= quint64(1) << i;
+    }
+    return word;
+}
+
+template <typename T>
+void scalarInRange(const T *values, int n, T lo, T hi, quint64 *bits)
+{
+    for (int base = 0; base < n; base += 64) {
+        bits[base / 64] = scalarWord(values + base, qMin(64, n - base), lo, hi);
+    }
+}
+
+#ifdef COLUMNKERNELS_X86
+
+// 以下各函数只处理完整的 64 行，剩余不足一个字的行由调用方走标量
+// 整数用 (v < lo) | (v > hi) 取反，避免 lo - 1 / hi + 1 溢出；
+// 浮点用有序比较（_CMP_GE_OQ / cmpge），NaN 两边都不成立
+
+COLUMNKERNELS_TARGET("sse2")
+void sse2InRange(const qint32 *values, int words, qint32 lo, qint32 hi, quint64 *bits)
+{
+    const __m128i vlo = _mm_set1_epi32(lo);
+    const __m128i vhi = _mm_set1_epi32(hi);
+    for (int w = 0; w < words; ++w) {
+        const qint32 *p = values + w * 64;
+        quint64 word = 0;
+        for (int i = 0; i < 64; i += 4) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+            const __m128i out = _mm_or_si128(_mm_cmpgt_epi32(vlo, v), _mm_cmpgt_epi32(v, vhi));
+            word |= quint64(~_mm_movemask_ps(_mm_castsi128_ps(out)) & 0xF) << i;
+        }
+        bits[w] = word;
+    }
+}
+
+COLUMNKERNELS_TARGET("sse2")
+void sse2InRange(const double *values, int words, double lo, double hi, quint64 *bits)
+{
+    const __m128d vlo = _mm_set1_pd(lo);
+    const __m128d vhi = _mm_set1_pd(hi);
+    for (int w = 0; w < words; ++w) {
+        const double *p = values + w * 64;
+        quint64 word = 0;
+        for (int i = 0; i < 64; i += 2) {
+            const __m128d v = _mm_loadu_pd(p + i);
+            const __m128d in = _mm_and_pd(_mm_cmpge_pd(v, vlo), _mm_cmple_pd(v, vhi));
+            word |= quint64(_mm_movemask_pd(in)) << i;
+        }
+        bits[w] = word;
+    }
+}
+
+COLUMNKERNELS_TARGET("avx2")
+void avx2InRange(const qint32 *values, int words, qint32 lo, qint32 hi, quint64 *bits)
+{
+    const __m256i vlo = _mm256_set1_epi32(lo);
+    const __m256i vhi = _mm256_set1_epi32(hi);
+    for (int w = 0; w < words; ++w) {
+        const qint32 *p = values + w * 64;
+        quint64 word = 0;
+        for (int i = 0; i < 64; i += 8) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+            const __m256i out = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, v), _mm256_cmpgt_epi32(v, vhi));
+            word |= quint64(~_mm256_movemask_ps(_mm256_castsi256_ps(out)) & 0xFF) << i;
+        }
+        bits[w] = word;
+    }
+}
+
+COLUMNKERNELS_TARGET("avx2")
+void avx2InRange(const double *values, int words, double lo, double hi, quint64 *bits)
+{
+    const __m256d vlo = _mm256_set1_pd(lo);
+    const __m256d vhi = _mm256_set1_pd(hi);
+    for (int w = 0; w < words; ++w) {
+        const double *p = values + w * 64;
+        quint64 word = 0;
+        for (int i = 0; i < 64; i += 4) {
+            const __m256d v = _mm256_loadu_pd(p + i);
+            const __m256d in = _mm256_and_pd(_mm256_cmp_pd(v, vlo, _CMP_GE_OQ), _mm256_cmp_pd(v, vhi, _CMP_LE_OQ));
+            word |= quint64(_mm256_movemask_pd(in)) << i;
+        }
+        bits[w] = word;
+    }
+}
+
+Level detectLevel()
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Avx2Level;
+    if (__builtin_cpu_supports("sse2")) return Sse2Level;
+    return ScalarLevel;
+}
+
+#else
+
+Level detectLevel()
+{
+    return ScalarLevel;
+}
+
+#endif
+
+Level supportedLevel()
+{
+    static const Level supported = detectLevel();
+    return supported;
+}
+
+std::atomic<int> &activeLevel()
+{
+    static std::atomic<int> active(supportedLevel());
+    return active;
+}
+
+template <typename T>
+void inRange(const T *values, int n, T lo, T hi, quint64 *bits)
+{
+    const int words = n / 64;
+    switch (level()) {
+#ifdef COLUMNKERNELS_X86
+    case Avx2Level:
+        avx2InRange(values, words, lo, hi, bits);
+        break;
+    case Sse2Level:
+        sse2InRange(values, words, lo, hi, bits);
+        break;
+#endif
+    default:
+        scalarInRange(values, words * 64, lo, hi, bits);
+        break;
+    }
+    if (n % 64 != 0) bits[words] = scalarWord(values + words * 64, n % 64, lo, hi);
+}
+
+} // namespace
+
+Level level()
+{
+    return Level(activeLevel().load(std::memory_order_relaxed));
+}
+
+void setLevel(Level level)
+{
+    activeLevel().store(qMin(level, supportedLevel()), std::memory_order_relaxed);
+}
+
+int wordCount(int n)
+{
+    return (n + 63) / 64;
+}
+
+void selectInRange(const qint32 *values, int n, qint32 lo, qint32 hi, quint64 *bits)
+{
+    inRange(values, n, lo, hi, bits);
+}
+
+void selectInRange(const double *values, int n, double lo, double hi, quint64 *bits)
+{
+    inRange(values, n, lo, hi, bits);
+}
+
+// 位图运算是逐字的简单循环，编译器在各级别下都能自动向量化
+void andBits(const quint64 *a, const quint64 *b, quint64 *out, int n)
+{
+    const int words = wordCount(n);
+    for (int w = 0; w < words; ++w) out[w] = a[w] & b[w];
+}
+
+void orBits(const quint64 *a, const quint64 *b, quint64 *out, int n)
+{
+    const int words = wordCount(n);
+    for (int w = 0; w < words; ++w) out[w] = a[w] | b[w];
+}
+
+void notBits(const quint64 *a, quint64 *out, int n)
+{
+    const int words = wordCount(n);
+    for (int w = 0; w < words; ++w) out[w] = ~a[w];
+    if (words > 0) out[words - 1] &= tailMask(n);
+}
+
+int countBits(const quint64 *bits, int n)
+{
+    const int words = wordCount(n);
+    int count = 0;
+    for (int w = 0; w < words; ++w) count += qPopulationCount(bits[w]);
+    return count;
+}
+
+QVector<int> rowsOf(const quint64 *bits, int n)
+{
+    QVector<int> rows;
+    rows.reserve(countBits(bits, n));
+    const int words = wordCount(n);
+    for (int w = 0; w < words; ++w) {
+        for (quint64 word = bits[w]; word != 0; word &= word - 1) {
+            rows.append(w * 64 + int(qCountTrailingZeroBits(word)));
+        }
+    }
+    return rows;
+}
+
+} // namespace ColumnKernels
@@ -0,0 +1,42 @@
+#ifndef COLUMNKERNELS_H
+#define COLUMNKERNELS_H
+
+#include <QtGlobal>
+#include <QVector>
+
+// 数值列上的谓词内核：把逐行比较的结果写成选择位图
+//
+// 位图与 CatalogColumns::availableBits() 布局相同：第 row 行为第 row / 64 个字的第 row % 64 位，
+// 需要 wordCount(n) 个字，最后一个字中超出 n 的高位总是置零。
+// x86 上首次调用时检测 CPU：支持 AVX2 时一次比较 8 个整数或 4 个 double，
+// 否则用 SSE2；其他平台走标量实现。各实现的结果逐位一致。
+namespace ColumnKernels {
+
+enum Level {
+    ScalarLevel,
+    Sse2Level,
+    Avx2Level
+};
+
+// 当前使用的实现
+Level level();
+// 指定实现（超出 CPU 能力时退回可用的最高一级），用于对比各实现的结果与耗时（见 bench/bench.cpp）
+void setLevel(Level level);
+
+int wordCount(int n);
+
+// lo <= values[i] <= hi 的行；double 列上 NaN 不入选
+void selectInRange(const qint32 *values, int n, qint32 lo, qint32 hi, quint64 *bits);
+void selectInRange(const double *values, int n, double lo, double hi, quint64 *bits);
+
+// 位图运算，n 为行数
+void andBits(const quint64 *a, const quint64 *b, quint64 *out, int n);
+void orBits(const quint64 *a, const quint64 *b, quint64 *out, int n);
+void notBits(const quint64 *a, quint64 *out, int n);
+int countBits(const quint64 *bits, int n);
+// 置位的行号，升序
+QVector<int> rowsOf(const quint64 *bits, int n);
+
+} // namespace ColumnKernels
+
+#endif // COLUMNKERNELS_H
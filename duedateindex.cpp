@@ -0,0 +1,77 @@
+#include "duedateindex.h"
+#include "catalogcolumns.h"
+
+#include <algorithm>
+
+void DueDateIndex::clear()
+{
+    buckets_.clear();
+    loanCount_ = 0;
+}
+
+void DueDateIndex::rebuild(const QVector<qint32> &returnDays)
+{
+    clear();
+    // 按行号顺序追加，每个桶天然有序
+    for (int i = 0; i < returnDays.size(); ++i) {
+        if (returnDays[i] == CatalogColumns::kNoDay) continue;
+        buckets_[returnDays[i]].append(i);
+        ++loanCount_;
+    }
+}
+
+void DueDateIndex::insert(const QDate &dueDate, int row)
+{
+    if (!dueDate.isValid()) return;
+    QVector<int> &bucket = buckets_[dueDate.toJulianDay()];
+    bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), row), row);
+    ++loanCount_;
+}
+
+void DueDateIndex::remove(const QDate &dueDate, int row)
+{
+    if (!dueDate.isValid()) return;
+    auto it = buckets_.find(dueDate.toJulianDay());
+    if (it == buckets_.end()) return;
+    QVector<int> &bucket = it.value();
+    const auto pos = std::lower_bound(bucket.begin(), bucket.end(), row);
+    if (pos == bucket.end() || *pos != row) return;
+    bucket.erase(pos);
+    --loanCount_;
+    if (bucket.isEmpty()) buckets_.erase(it);
+}
+
+void DueDateIndex::removeRow(int row)
+{
+    for (auto it = buckets_.begin(); it != buckets_.end(); ++it) {
+        QVector<int> &bucket = it.value();
+        for (auto p = std::upper_bound(bucket.begin(), bucket.end(), row); p != bucket.end(); ++p) {
+            --*p;
+        }
+    }
+}
+
+QVector<int> DueDateIndex::rows(const QDate &first, const QDate &last) const
+{
+    if (!first.isValid() || !last.isValid() || first > last) return QVector<int>();
+    return collect(buckets_.lowerBound(first.toJulianDay()), buckets_.upperBound(last.toJulianDay()));
+}
+
+QVector<int> DueDateIndex::rowsBefore(const QDate &day) const
+{
+    if (!day.isValid()) return QVector<int>();
+    return collect(buckets_.cbegin(), buckets_.lowerBound(day.toJulianDay()));
+}
+
+int DueDateIndex::loanCount() const
+{
+    return loanCount_;
+}
+
+QVector<int> DueDateIndex::collect(QMap<qint64, QVector<int>>::const_iterator first,
+                                   QMap<qint64, QVector<int>>::const_iterator last) const
+{
+    QVector<int> result;
+    for (auto it = first; it != last; ++it) result += it.value();
+    return result;
+}
@@ -0,0 +1,39 @@
+#ifndef DUEDATEINDEX_H
+#define DUEDATEINDEX_H
+
+#include <QMap>
+#include <QVector>
+#include <QDate>
+
+// 按归还日期分桶的借阅索引：儒略日 -> 升序行号列表
+//
+// 只收录 returnDate 有效（已借出）的图书。"N 天内到期"和"已逾期"都是
+// 对有序桶的区间遍历，代价与命中的图书数成正比，不再逐本计算 daysTo。
+class DueDateIndex {
+public:
+    void clear();
+    // 按归还日期列（儒略日，见 CatalogColumns）重建
+    void rebuild(const QVector<qint32> &returnDays);
+
+    // 无效日期被忽略，调用方不必区分是否已借出
+    void insert(const QDate &dueDate, int row);
+    void remove(const QDate &dueDate, int row);
+    // 删除 row 之后，把所有大于 row 的行号减一
+    void removeRow(int row);
+
+    // 归还日期在 [first, last] 内的行，按日期升序，同一天内按行号升序
+    QVector<int> rows(const QDate &first, const QDate &last) const;
+    // 归还日期早于 day 的行
+    QVector<int> rowsBefore(const QDate &day) const;
+    int loanCount() const;
+
+private:
+    QVector<int> collect(QMap<qint64, QVector<int>>::const_iterator first,
+                         QMap<qint64, QVector<int>>::const_iterator last) const;
+
+private:
+    QMap<qint64, QVector<int>> buckets_;
+    int loanCount_ = 0;
+};
+
+#endif // DUEDATEINDEX_H
@@ -1,14 +1,48 @@
 #include "librarymanager.h"
+#include "bookfields.h"
+#include "catalogreader.h"
+#include "catalogsnapshot.h"
+#include "circulationjournal.h"
+#include "columnkernels.h"
+#include "queryplanner.h"
 
 #include <QFile>
+#include <QSaveFile>
+#include <QElapsedTimer>
+#include <QSignalBlocker>
+#include <QTimer>
+#include <QDateTime>
 #include <QJsonDocument>
 #include <QJsonArray>
-#include <QMap>
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace {
+const int kLoadProgressBatch = 4096;   // 每读入多少本图书报告一次进度
+const int kCheckpointEntries = 20000;  // 日志累计到该条数时自动做检查点，限制重放时间
+const int kCheckpointIntervalMs = 5 * 60 * 1000;
+}
 
 LibraryManager::LibraryManager(QObject *parent)
     : QObject(parent)
 {
+    // 保存任务按提交顺序依次执行，避免两次保存同一文件时互相覆盖
+    saveThreadPool_.setMaxThreadCount(1);
+
+    overdueCheckedDay_ = QDate::currentDate();
+    dayTimer_ = new QTimer(this);
+    dayTimer_->setSingleShot(true);
+    connect(dayTimer_, &QTimer::timeout, this, [this]() { onDayBoundary(); });
+    scheduleDayBoundary();
+}
+
+LibraryManager::~LibraryManager()
+{
+    closeStore();
+    // 等待后台保存结束；尚未投递的 saveFinished 随对象销毁一并丢弃
+    saveThreadPool_.waitForDone();
 }
 
 bool LibraryManager::loadFromFile(const QString &filePath, QString *errorMessage)
@@ -18,43 +52,273 @@ bool LibraryManager::loadFromFile(const QString &filePath, QString *errorMessage
         if (errorMessage) *errorMessage = QString::fromLatin1("无法打开文件: ") + filePath;
         return false;
     }
-    const QByteArray data = f.readAll();
+    // 流式解析：逐条读入 Book，不在内存中构建整个 JSON 文档
+    const qint64 totalBytes = f.size();
+    CatalogJsonReader reader(&f);
+    CatalogColumns loaded;
+    Book b;
+    while (reader.readNext(&b)) {
+        loaded.append(b);
+        if (loaded.size() % kLoadProgressBatch == 0) {
+            emit loadProgress(int(loaded.size()), reader.bytesConsumed(), totalBytes);
+        }
+    }
     f.close();
-    QJsonParseError pe;
-    const QJsonDocument doc = QJsonDocument::fromJson(data, &pe);
-    if (pe.error != QJsonParseError::NoError || !doc.isArray()) {
-        if (errorMessage) *errorMessage = QString::fromLatin1("JSON 解析失败");
+    if (reader.hasError()) {
+        if (errorMessage) *errorMessage = QStringLiteral("JSON 解析失败: ") + reader.errorString();
         return false;
     }
-    books_.clear();
-    const QJsonArray arr = doc.array();
-    books_.reserve(arr.size());
-    for (const QJsonValue &v : arr) {
-        if (!v.isObject()) continue;
-        books_.append(fromJson(v.toObject()));
-    }
+    emit loadProgress(int(loaded.size()), totalBytes, totalBytes);
+
+    emit catalogAboutToBeReset();
+    ++catalogVersion_;
+    columns_ = std::move(loaded);
+    rebuildIndexes();
+    emit catalogReset();
+    // 导入的目录整体替换了存储内容，直接写成新的检查点
+    if (journal_) startCheckpoint();
     return true;
 }
 
 bool LibraryManager::saveToFile(const QString &filePath, QString *errorMessage) const
+{
+    return writeJsonFile(filePath, columns_.toBooks(), errorMessage);
+}
+
+bool LibraryManager::writeJsonFile(const QString &filePath, const QVector<Book> &books, QString *errorMessage)
 {
     QJsonArray arr;
-    for (const Book &b : books_) {
+    for (const Book &b : books) {
         QJsonObject obj;
         toJson(obj, b);
         arr.append(obj);
     }
     const QJsonDocument doc(arr);
-    QFile f(filePath);
-    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    // QSaveFile 写完后原子替换，保存中途失败不会留下半个文件
+    QSaveFile f(filePath);
+    if (!f.open(QIODevice::WriteOnly)) {
         if (errorMessage) *errorMessage = QString::fromLatin1("无法写入文件: ") + filePath;
         return false;
     }
     f.write(doc.toJson(QJsonDocument::Indented));
-    f.close();
+    if (!f.commit()) {
+        if (errorMessage) *errorMessage = QString::fromLatin1("无法写入文件: ") + filePath;
+        return false;
+    }
+    return true;
+}
+
+quint64 LibraryManager::saveToFileAsync(const QString &filePath)
+{
+    return startAsyncSave(filePath, false);
+}
+
+quint64 LibraryManager::saveToSnapshotAsync(const QString &filePath)
+{
+    return startAsyncSave(filePath, true);
+}
+
+quint64 LibraryManager::startAsyncSave(const QString &filePath, bool snapshot)
+{
+    const quint64 saveId = ++lastSaveId_;
+    // 复制各列只增加引用计数（隐式共享），后台线程读取的是此刻的不可变版本；
+    // 之后界面线程上的借还会让被改动的列自行分离，不影响正在写入的内容
+    const CatalogColumns columns = columns_;
+    saveThreadPool_.start([this, saveId, filePath, columns, snapshot]() {
+        QString err;
+        const QVector<Book> books = columns.toBooks();
+        const bool ok = snapshot ? CatalogSnapshot::write(filePath, books, 0, &err)
+                                 : writeJsonFile(filePath, books, &err);
+        QMetaObject::invokeMethod(this, [this, saveId, filePath, ok, err]() {
+            emit saveFinished(saveId, filePath, ok, err);
+        }, Qt::QueuedConnection);
+    });
+    return saveId;
+}
+
+bool LibraryManager::loadFromSnapshot(const QString &filePath, QString *errorMessage)
+{
+    CatalogSnapshot snapshot;
+    if (!snapshot.open(filePath, errorMessage)) return false;
+    CatalogColumns loaded;
+    loaded.reserve(snapshot.count());
+    // 快照以记录数代替字节数报告进度
+    for (int i = 0; i < snapshot.count(); ++i) {
+        loaded.append(snapshot.bookAt(i));
+        if ((i + 1) % kLoadProgressBatch == 0) {
+            emit loadProgress(i + 1, qint64(i + 1), qint64(snapshot.count()));
+        }
+    }
+    emit loadProgress(snapshot.count(), qint64(snapshot.count()), qint64(snapshot.count()));
+
+    emit catalogAboutToBeReset();
+    ++catalogVersion_;
+    columns_ = std::move(loaded);
+    rebuildIndexes();
+    emit catalogReset();
+    if (journal_) startCheckpoint();
     return true;
 }
 
+bool LibraryManager::saveToSnapshot(const QString &filePath, QString *errorMessage) const
+{
+    return CatalogSnapshot::write(filePath, columns_.toBooks(), 0, errorMessage);
+}
+
+bool LibraryManager::convertJsonToSnapshot(const QString &jsonPath, const QString &snapshotPath, QString *errorMessage)
+{
+    LibraryManager catalog;
+    return catalog.loadFromFile(jsonPath, errorMessage)
+        && catalog.saveToSnapshot(snapshotPath, errorMessage);
+}
+
+bool LibraryManager::convertSnapshotToJson(const QString &snapshotPath, const QString &jsonPath, QString *errorMessage)
+{
+    LibraryManager catalog;
+    return catalog.loadFromSnapshot(snapshotPath, errorMessage)
+        && catalog.saveToFile(jsonPath, errorMessage);
+}
+
+bool LibraryManager::openStore(const QString &snapshotPath, const QString &journalPath, QString *errorMessage)
+{
+    closeStore();
+    QElapsedTimer timer;
+    timer.start();
+
+    quint64 snapshotSequence = 0;
+    CirculationJournal *journal = new CirculationJournal(this);
+    int replayed = 0;
+    bool ok = true;
+    emit catalogAboutToBeReset();
+    ++catalogVersion_;
+    {
+        // 恢复过程中逐条的变更信号没有意义，结束后统一发出 catalogReset
+        QSignalBlocker blocker(this);
+        if (QFile::exists(snapshotPath)) {
+            CatalogSnapshot snapshot;
+            // 这里只读取文件头中的日志序号，完整校验由 loadFromSnapshot 负责
+            ok = snapshot.open(snapshotPath, errorMessage, false);
+            if (ok) {
+                snapshotSequence = snapshot.journalSequence();
+                snapshot.close();
+                ok = loadFromSnapshot(snapshotPath, errorMessage);
+            }
+        } else {
+            columns_.clear();
+            rebuildIndexes();
+        }
+        if (ok) {
+            ok = journal->open(journalPath, snapshotSequence, [this](const CirculationJournal::Entry &e) {
+                switch (e.operation) {
+                case CirculationJournal::AddOperation:    addBook(e.book); break;
+                case CirculationJournal::UpdateOperation: updateBook(e.indexId, e.book); break;
+                case CirculationJournal::RemoveOperation: removeBookByIndexId(e.indexId); break;
+                case CirculationJournal::BorrowOperation: borrowBook(e.indexId, e.dueDate); break;
+                case CirculationJournal::ReturnOperation: returnBook(e.indexId); break;
+                }
+            }, &replayed, errorMessage);
+        }
+    }
+    emit catalogReset();
+    if (!ok) {
+        delete journal;
+        return false;
+    }
+
+    journal_ = journal;
+    connect(journal_, &CirculationJournal::writeFailed, this, &LibraryManager::storeError);
+    snapshotPath_ = snapshotPath;
+    checkpointTimer_ = new QTimer(this);
+    checkpointTimer_->setInterval(kCheckpointIntervalMs);
+    connect(checkpointTimer_, &QTimer::timeout, this, [this]() {
+        if (journal_ && checkpointsInFlight_ == 0 && journal_->entriesSinceReset() > 0) startCheckpoint();
+    });
+    checkpointTimer_->start();
+
+    lastRecoveredEntries_ = replayed;
+    lastRecoveryMs_ = timer.elapsed();
+    if (journal_->entriesSinceReset() >= kCheckpointEntries) startCheckpoint();
+    return true;
+}
+
+void LibraryManager::closeStore()
+{
+    if (!journal_) return;
+    // 等后台检查点写完；其完成回调随后到达时存储已换代，直接忽略
+    saveThreadPool_.waitForDone();
+    ++storeGeneration_;
+    checkpointsInFlight_ = 0;
+    // 正常退出时做一次检查点，下次启动无需重放
+    if (journal_->entriesSinceReset() > 0) checkpoint();
+    journal_->close();
+    delete journal_;
+    journal_ = nullptr;
+    delete checkpointTimer_;
+    checkpointTimer_ = nullptr;
+    snapshotPath_.clear();
+}
+
+bool LibraryManager::isStoreOpen() const
+{
+    return journal_ != nullptr;
+}
+
+bool LibraryManager::checkpoint(QString *errorMessage)
+{
+    if (!journal_) return false;
+    // 后台检查点可能正在写同一个快照文件，等它写完，免得较旧的内容后落盘
+    saveThreadPool_.waitForDone();
+    QString err;
+    const quint64 sequence = journal_->lastSequence();
+    // 快照写入成功（QSaveFile 原子替换）之后才清空日志；
+    // 两步之间崩溃时，快照中记录的序号保证旧日志不会被重复重放
+    if (!CatalogSnapshot::write(snapshotPath_, columns_.toBooks(), sequence, &err)) {
+        if (errorMessage) *errorMessage = err;
+        emit storeError(err);
+        return false;
+    }
+    return journal_->reset(sequence);
+}
+
+void LibraryManager::startCheckpoint()
+{
+    // 与 startAsyncSave 相同：列隐式共享，写快照期间界面线程照常借还并追加日志
+    const CatalogColumns columns = columns_;
+    const quint64 sequence = journal_->lastSequence();
+    const QString filePath = snapshotPath_;
+    const quint64 generation = storeGeneration_;
+    ++checkpointsInFlight_;
+    saveThreadPool_.start([this, columns, sequence, filePath, generation]() {
+        QString err;
+        const bool ok = CatalogSnapshot::write(filePath, columns.toBooks(), sequence, &err);
+        QMetaObject::invokeMethod(this, [this, sequence, generation, ok, err]() {
+            if (generation != storeGeneration_) return;
+            --checkpointsInFlight_;
+            if (!ok) {
+                emit storeError(err);
+                return;
+            }
+            // 只丢弃快照已包含的记录，写快照期间追加的记录留待下一次检查点
+            journal_->reset(sequence);
+        }, Qt::QueuedConnection);
+    });
+}
+
+qint64 LibraryManager::lastRecoveryMs() const
+{
+    return lastRecoveryMs_;
+}
+
+int LibraryManager::lastRecoveredEntries() const
+{
+    return lastRecoveredEntries_;
+}
+
+void LibraryManager::afterJournalAppend()
+{
+    if (checkpointsInFlight_ == 0 && journal_->entriesSinceReset() >= kCheckpointEntries) startCheckpoint();
+}
+
 bool LibraryManager::addBook(const Book &book, QString *errorMessage)
 {
     if (book.indexId.trimmed().isEmpty()) {
@@ -65,7 +329,16 @@ bool LibraryManager::addBook(const Book &book, QString *errorMessage)
         if (errorMessage) *errorMessage = QString::fromLatin1("索引号已存在");
         return false;
     }
-    books_.append(book);
+    const int row = columns_.size();
+    emit bookAboutToBeInserted(row, book.indexId);
+    ++catalogVersion_;
+    columns_.append(book);
+    indexInsertedBook(row);
+    emit bookInserted(row, book.indexId);
+    if (journal_) {
+        journal_->logAdd(book);
+        afterJournalAppend();
+    }
     return true;
 }
 
@@ -73,7 +346,19 @@ bool LibraryManager::removeBookByIndexId(const QString &indexId)
 {
     const int pos = findIndexById(indexId);
     if (pos < 0) return false;
-    books_.removeAt(pos);
+    const Book removed = columns_.book(pos);
+    const QString &removedId = removed.indexId;
+    emit bookAboutToBeRemoved(pos, removedId);
+    ++catalogVersion_;
+    const int categoryCode = columns_.categoryCodes()[pos];
+    const int locationCode = columns_.locationCodes()[pos];
+    columns_.removeAt(pos);
+    indexRemovedBook(pos, removed, categoryCode, locationCode);
+    emit bookRemoved(pos, removedId);
+    if (journal_) {
+        journal_->logRemove(removedId);
+        afterJournalAppend();
+    }
     return true;
 }
 
@@ -88,24 +373,22 @@ bool LibraryManager::updateBook(const QString &indexId, const Book &updated, QSt
         if (errorMessage) *errorMessage = QString::fromLatin1("新索引号已存在");
         return false;
     }
-    books_[pos] = updated;
-    return true;
-}
-
-Book *LibraryManager::findByName(const QString &name)
-{
-    for (Book &b : books_) {
-        if (b.name.compare(name, Qt::CaseInsensitive) == 0) return &b;
+    const Book before = columns_.book(pos);
+    const int categoryCode = columns_.categoryCodes()[pos];
+    const int locationCode = columns_.locationCodes()[pos];
+    columns_.set(pos, updated);
+    indexUpdatedBook(pos, before, categoryCode, locationCode);
+    emit bookChanged(pos, updated.indexId);
+    if (journal_) {
+        journal_->logUpdate(indexId, updated);
+        afterJournalAppend();
     }
-    return nullptr;
+    return true;
 }
 
-const Book *LibraryManager::findByName(const QString &name) const
+int LibraryManager::indexOfName(const QString &name) const
 {
-    for (const Book &b : books_) {
-        if (b.name.compare(name, Qt::CaseInsensitive) == 0) return &b;
-    }
-    return nullptr;
+    return textIndex_.findExact(NGramIndex::NameField, name);
 }
 
 bool LibraryManager::borrowBook(const QString &indexId, QDate dueDate, QString *errorMessage)
@@ -115,15 +398,19 @@ bool LibraryManager::borrowBook(const QString &indexId, QDate dueDate, QString *
         if (errorMessage) *errorMessage = QString::fromLatin1("未找到该图书");
         return false;
     }
-    Book &b = books_[pos];
-    if (!b.available || b.quantity <= 0) {
+    if (!columns_.available(pos) || columns_.quantity(pos) <= 0) {
         if (errorMessage) *errorMessage = QString::fromLatin1("不可借或库存不足");
         return false;
     }
-    b.quantity -= 1;
-    b.borrowCount += 1;
-    b.available = b.quantity > 0;
-    b.returnDate = dueDate;
+    const Book before = columns_.book(pos);
+    const int quantity = before.quantity - 1;
+    columns_.setCirculation(pos, quantity, before.borrowCount + 1, quantity > 0, dueDate);
+    indexCirculationChange(pos, before);
+    emit bookChanged(pos, indexId);
+    if (journal_) {
+        journal_->logBorrow(indexId, dueDate);
+        afterJournalAppend();
+    }
     return true;
 }
 
@@ -134,277 +421,529 @@ bool LibraryManager::returnBook(const QString &indexId, QString *errorMessage)
         if (errorMessage) *errorMessage = QString::fromLatin1("未找到该图书");
         return false;
     }
-    Book &b = books_[pos];
-    b.quantity += 1;
-    b.available = b.quantity > 0;
-    b.returnDate = QDate();
+    const Book before = columns_.book(pos);
+    const int quantity = before.quantity + 1;
+    columns_.setCirculation(pos, quantity, before.borrowCount, quantity > 0, QDate());
+    indexCirculationChange(pos, before);
+    emit bookChanged(pos, indexId);
+    if (journal_) {
+        journal_->logReturn(indexId);
+        afterJournalAppend();
+    }
     return true;
 }
 
-QVector<Book> LibraryManager::getAll() const
+int LibraryManager::count() const
+{
+    return columns_.size();
+}
+
+Book LibraryManager::bookAt(int row) const
+{
+    return columns_.book(row);
+}
+
+int LibraryManager::indexOf(const QString &indexId) const
+{
+    return findIndexById(indexId);
+}
+
+const CatalogColumns &LibraryManager::columns() const
+{
+    return columns_;
+}
+
+quint64 LibraryManager::catalogVersion() const
+{
+    return catalogVersion_;
+}
+
+BookView LibraryManager::getAll() const
 {
-    return books_;
+    return BookView::all(this);
 }
 
-QVector<Book> LibraryManager::getDueInDays(int days) const
+BookView LibraryManager::getDueInDays(int days) const
+{
+    return viewOf(rowsDueInDays(days));
+}
+
+QVector<int> LibraryManager::rowsDueInDays(int days) const
 {
-    QVector<Book> res;
     const QDate today = QDate::currentDate();
-    for (const Book &b : books_) {
-        if (b.returnDate.isValid()) {
-            const int diff = today.daysTo(b.returnDate);
-            if (diff >= 0 && diff <= days) res.append(b);
-        }
+    return dueDateIndex_.rows(today, today.addDays(days));
+}
+
+BookView LibraryManager::getOverdue() const
+{
+    return viewOf(rowsOverdue());
+}
+
+QVector<int> LibraryManager::rowsOverdue() const
+{
+    return dueDateIndex_.rowsBefore(QDate::currentDate());
+}
+
+void LibraryManager::scheduleDayBoundary()
+{
+    const QDateTime now = QDateTime::currentDateTime();
+    const QDateTime midnight(now.date().addDays(1), QTime(0, 0));
+    // 多等一秒，定时器略早触发时也不会停留在前一天
+    dayTimer_->start(int(now.msecsTo(midnight)) + 1000);
+}
+
+void LibraryManager::onDayBoundary()
+{
+    const QDate today = QDate::currentDate();
+    if (today > overdueCheckedDay_) {
+        // 到期日在 [上次检查日, 今天) 内的借阅刚刚变为逾期；
+        // 休眠或调整时钟跨过多天时一并报告
+        const QVector<int> rows = dueDateIndex_.rows(overdueCheckedDay_, today.addDays(-1));
+        overdueCheckedDay_ = today;
+        if (!rows.isEmpty()) emit booksBecameOverdue(rows);
     }
-    return res;
+    scheduleDayBoundary();
 }
 
 void LibraryManager::sortByBorrowCountDesc()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.borrowCount > b.borrowCount;
-    });
+    sortByBorrowCount();
 }
 
 int LibraryManager::findIndexById(const QString &indexId) const
 {
-    for (int i = 0; i < books_.size(); ++i) {
-        if (books_[i].indexId == indexId) return i;
-    }
-    return -1;
+    return idIndex_.value(indexId, -1);
+}
+
+void LibraryManager::rebuildIndexes()
+{
+    const int n = columns_.size();
+    const QVector<QString> &ids = columns_.indexIds();
+    idIndex_.clear();
+    idIndex_.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        // 文件中若有重复索引号，与原先的线性查找一致，以第一条为准
+        if (!idIndex_.contains(ids[i])) idIndex_.insert(ids[i], i);
+    }
+    categoryIndex_.rebuild(columns_.categoryCodes(), columns_.categoryDictionary().size());
+    locationIndex_.rebuild(columns_.locationCodes(), columns_.locationDictionary().size());
+    priceIndex_.rebuild(columns_.prices());
+    dueDateIndex_.rebuild(columns_.returnDays());
+    borrowRankIndex_.rebuild(columns_.borrowCounts());
+    textIndex_.rebuild(columns_);
+    pinyinIndex_.rebuild(columns_);
+    suggestionTrie_.rebuild(columns_);
+    sortPermutations_.rebuild(columns_);
+    recomputeStatistics();
 }
 
-// 新增实用功能实现
-QVector<Book> LibraryManager::getByCategory(const QString &category) const
+void LibraryManager::indexInsertedBook(int row)
+{
+    const Book b = columns_.book(row);
+    idIndex_.insert(b.indexId, row);
+    addToStatistics(b, 1);
+    categoryIndex_.insert(columns_.categoryCodes()[row], row);
+    locationIndex_.insert(columns_.locationCodes()[row], row);
+    priceIndex_.insert(b.price, row);
+    dueDateIndex_.insert(b.returnDate, row);
+    borrowRankIndex_.insert(b.borrowCount, row);
+    textIndex_.insert(row, columns_);
+    pinyinIndex_.insert(row, columns_);
+    suggestionTrie_.insert(row, columns_);
+    sortPermutations_.insert(row);
+}
+
+void LibraryManager::indexRemovedBook(int row, const Book &removed, int categoryCode, int locationCode)
 {
-    QVector<Book> result;
-    for (const Book &book : books_) {
-        if (book.category.contains(category, Qt::CaseInsensitive)) {
-            result.append(book);
-        }
+    idIndex_.remove(removed.indexId);
+    addToStatistics(removed, -1);
+    // 删除位置之后的图书整体前移一位
+    const QVector<QString> &ids = columns_.indexIds();
+    for (int i = row; i < ids.size(); ++i) {
+        idIndex_[ids[i]] = i;
     }
-    return result;
+    categoryIndex_.remove(categoryCode, row);
+    categoryIndex_.removeRow(row);
+    locationIndex_.remove(locationCode, row);
+    locationIndex_.removeRow(row);
+    priceIndex_.remove(removed.price, row);
+    priceIndex_.removeRow(row);
+    dueDateIndex_.remove(removed.returnDate, row);
+    dueDateIndex_.removeRow(row);
+    borrowRankIndex_.remove(removed.borrowCount, row);
+    borrowRankIndex_.removeRow(row);
+    textIndex_.removeRow(row);
+    pinyinIndex_.removeRow(row);
+    suggestionTrie_.removeRow(row);
+    sortPermutations_.removeRow(row);
 }
 
-QVector<Book> LibraryManager::getByLocation(const QString &location) const
+void LibraryManager::indexUpdatedBook(int row, const Book &before, int categoryCode, int locationCode)
 {
-    QVector<Book> result;
-    for (const Book &book : books_) {
-        if (book.location.contains(location, Qt::CaseInsensitive)) {
-            result.append(book);
-        }
+    const Book b = columns_.book(row);
+    if (b.indexId != before.indexId) {
+        idIndex_.remove(before.indexId);
+        idIndex_.insert(b.indexId, row);
     }
-    return result;
+    if (columns_.categoryCodes()[row] != categoryCode) {
+        categoryIndex_.remove(categoryCode, row);
+        categoryIndex_.insert(columns_.categoryCodes()[row], row);
+    }
+    if (columns_.locationCodes()[row] != locationCode) {
+        locationIndex_.remove(locationCode, row);
+        locationIndex_.insert(columns_.locationCodes()[row], row);
+    }
+    if (b.price != before.price) {
+        priceIndex_.remove(before.price, row);
+        priceIndex_.insert(b.price, row);
+    }
+    if (b.name != before.name || b.indexId != before.indexId
+        || b.category != before.category || b.location != before.location) {
+        textIndex_.update(row, columns_);
+    }
+    if (b.name != before.name) pinyinIndex_.update(row, columns_);
+    if (b.name != before.name || b.indexId != before.indexId) suggestionTrie_.update(row, columns_);
+    indexCirculationChange(row, before);
 }
 
-QVector<Book> LibraryManager::getAvailable() const
+void LibraryManager::indexCirculationChange(int row, const Book &before)
 {
-    QVector<Book> result;
-    for (const Book &book : books_) {
-        if (book.available && book.quantity > 0) {
-            result.append(book);
-        }
+    // 借还只改动数量、借阅次数、可借状态与归还日期
+    addToStatistics(before, -1);
+    addToStatistics(columns_.quantity(row), columns_.price(row), columns_.available(row), 1);
+    const QDate returnDate = columns_.returnDate(row);
+    if (returnDate != before.returnDate) {
+        dueDateIndex_.remove(before.returnDate, row);
+        dueDateIndex_.insert(returnDate, row);
+    }
+    const int borrowCount = columns_.borrowCount(row);
+    if (borrowCount != before.borrowCount) {
+        borrowRankIndex_.remove(before.borrowCount, row);
+        borrowRankIndex_.insert(borrowCount, row);
+        suggestionTrie_.setWeight(row, borrowCount);
     }
-    return result;
+    // 编辑也经由这里：任一字段变化都可能打破某个排列的顺序
+    const int from = sortPermutations_.currentPosition(row);
+    sortPermutations_.update(row);
+    const int to = sortPermutations_.currentPosition(row);
+    if (to != from) emit bookMoved(row, from, to);
 }
 
-QVector<Book> LibraryManager::getBorrowed() const
+void LibraryManager::addToStatistics(const Book &b, int sign)
 {
-    QVector<Book> result;
-    for (const Book &book : books_) {
-        if (!book.available || book.quantity == 0) {
-            result.append(book);
-        }
-    }
-    return result;
+    addToStatistics(b.quantity, b.price, b.available, sign);
 }
 
-QVector<Book> LibraryManager::searchBooks(const QString &keyword) const
+void LibraryManager::addToStatistics(int quantity, double price, bool available, int sign)
 {
-    QVector<Book> result;
-    QString lowerKeyword = keyword.toLower();
-    for (const Book &book : books_) {
-        if (book.name.toLower().contains(lowerKeyword) ||
-            book.category.toLower().contains(lowerKeyword) ||
-            book.location.toLower().contains(lowerKeyword) ||
-            book.indexId.toLower().contains(lowerKeyword)) {
-            result.append(book);
-        }
-    }
-    return result;
+    if (available && quantity > 0) stats_.available += sign;
+    if (!available || quantity == 0) stats_.borrowed += sign;
+    stats_.totalValue += sign * (price * quantity);
 }
 
-QVector<Book> LibraryManager::getTopBorrowed(int limit) const
+void LibraryManager::recomputeStatistics()
 {
-    QVector<Book> result = books_;
-    std::sort(result.begin(), result.end(), [](const Book &a, const Book &b){
-        return a.borrowCount > b.borrowCount;
-    });
-    if (limit > 0 && limit < result.size()) {
-        result.resize(limit);
-    }
-    return result;
+    // 计数取自选择位图，总价值逐列累加：数量、价格各自连续存放
+    const int n = columns_.size();
+    const int *quantities = columns_.quantities().constData();
+    const double *prices = columns_.prices().constData();
+    stats_ = Statistics();
+    stats_.available = ColumnKernels::countBits(QueryPlanner::availableSelection(columns_).constData(), n);
+    stats_.borrowed = ColumnKernels::countBits(QueryPlanner::borrowedSelection(columns_).constData(), n);
+    for (int i = 0; i < n; ++i) stats_.totalValue += prices[i] * quantities[i];
 }
 
-QVector<Book> LibraryManager::getRecentlyAdded(int days) const
+BookView LibraryManager::viewOf(const QVector<int> &rows) const
 {
-    QVector<Book> result;
-    QDate cutoffDate = QDate::currentDate().addDays(-days);
-    for (const Book &book : books_) {
-        if (book.inDate >= cutoffDate) {
-            result.append(book);
+    return BookView::fromRows(this, rows);
+}
+
+QString LibraryManager::mostFrequentValue(const StringDictionary &dictionary, const PostingListIndex &index)
+{
+    // 并列时取字典序最小者，与原先按 QMap 顺序取第一个最大值一致
+    int best = -1;
+    for (int code = 0; code < dictionary.size(); ++code) {
+        const int n = index.count(code);
+        if (n == 0) continue;
+        if (best < 0 || n > index.count(best)
+            || (n == index.count(best) && dictionary.valueOf(code) < dictionary.valueOf(best))) {
+            best = code;
         }
     }
-    return result;
+    return best < 0 ? QString() : dictionary.valueOf(best);
 }
 
-QVector<Book> LibraryManager::getExpensiveBooks(double minPrice) const
+QStringList LibraryManager::usedValues(const StringDictionary &dictionary, const PostingListIndex &index)
 {
-    QVector<Book> result;
-    for (const Book &book : books_) {
-        if (book.price >= minPrice) {
-            result.append(book);
-        }
+    QStringList result;
+    for (int code = 0; code < dictionary.size(); ++code) {
+        if (index.count(code) > 0) result.append(dictionary.valueOf(code));
     }
+    result.sort();
     return result;
 }
 
-QVector<Book> LibraryManager::getCheapBooks(double maxPrice) const
+// 新增实用功能实现
+BookView LibraryManager::getByCategory(const QString &category) const
+{
+    return viewOf(rowsByCategory(category));
+}
+
+QVector<int> LibraryManager::rowsByCategory(const QString &category) const
 {
-    QVector<Book> result;
-    for (const Book &book : books_) {
-        if (book.price <= maxPrice) {
-            result.append(book);
-        }
+    return categoryIndex_.rowsForCodes(columns_.categoryDictionary().codesContaining(category));
+}
+
+BookView LibraryManager::getByLocation(const QString &location) const
+{
+    return viewOf(rowsByLocation(location));
+}
+
+QVector<int> LibraryManager::rowsByLocation(const QString &location) const
+{
+    return locationIndex_.rowsForCodes(columns_.locationDictionary().codesContaining(location));
+}
+
+QStringList LibraryManager::categories() const
+{
+    return usedValues(columns_.categoryDictionary(), categoryIndex_);
+}
+
+QStringList LibraryManager::locations() const
+{
+    return usedValues(columns_.locationDictionary(), locationIndex_);
+}
+
+BookView LibraryManager::getAvailable() const
+{
+    return viewOf(availableRows());
+}
+
+QVector<int> LibraryManager::availableRows() const
+{
+    const QVector<quint64> bits = QueryPlanner::availableSelection(columns_);
+    return ColumnKernels::rowsOf(bits.constData(), columns_.size());
+}
+
+BookView LibraryManager::getBorrowed() const
+{
+    return viewOf(borrowedRows());
+}
+
+QVector<int> LibraryManager::borrowedRows() const
+{
+    const QVector<quint64> bits = QueryPlanner::borrowedSelection(columns_);
+    return ColumnKernels::rowsOf(bits.constData(), columns_.size());
+}
+
+BookView LibraryManager::searchBooks(const QString &keyword) const
+{
+    return viewOf(searchRows(keyword));
+}
+
+QVector<int> LibraryManager::searchRows(const QString &keyword) const
+{
+    return textIndex_.search(keyword);
+}
+
+BookView LibraryManager::fuzzySearch(const QString &keyword, int limit) const
+{
+    return viewOf(fuzzySearchRows(keyword, limit));
+}
+
+QVector<int> LibraryManager::fuzzySearchRows(const QString &keyword, int limit) const
+{
+    return searchSnapshot().fuzzySearch(keyword, limit);
+}
+
+SearchSnapshot LibraryManager::searchSnapshot() const
+{
+    return SearchSnapshot(textIndex_, pinyinIndex_, catalogVersion_);
+}
+
+QStringList LibraryManager::suggestions(const QString &prefix, int limit) const
+{
+    return suggestionTrie_.suggest(prefix, limit);
+}
+
+BookView LibraryManager::getTopBorrowed(int limit) const
+{
+    return viewOf(topBorrowedRows(limit));
+}
+
+QVector<int> LibraryManager::topBorrowedRows(int limit) const
+{
+    const int size = columns_.size();
+    const int n = limit > 0 ? qMin(limit, size) : size;
+    QVector<int> rows = borrowRankIndex_.topRows(n);
+    // 借过的书不足 K 本时，按目录顺序补上从未借出的书；
+    // 此时跳过的已收录图书少于 K 本，仍是 O(K)
+    const QVector<int> &borrowCounts = columns_.borrowCounts();
+    for (int i = 0; i < size && rows.size() < n; ++i) {
+        if (borrowCounts[i] <= 0) rows.append(i);
     }
-    return result;
+    return rows;
+}
+
+BookView LibraryManager::getRecentlyAdded(int days) const
+{
+    return viewOf(recentlyAddedRows(days));
+}
+
+QVector<int> LibraryManager::recentlyAddedRows(int days) const
+{
+    // 无效入库日期为 kNoDay（最小值），与原先 QDate 比较一样不会入选
+    const qint32 cutoff = CatalogColumns::toDay(QDate::currentDate().addDays(-days));
+    const int n = columns_.size();
+    QVector<quint64> bits(ColumnKernels::wordCount(n));
+    ColumnKernels::selectInRange(columns_.inDays().constData(), n, cutoff, std::numeric_limits<qint32>::max(), bits.data());
+    return ColumnKernels::rowsOf(bits.constData(), n);
+}
+
+BookView LibraryManager::getExpensiveBooks(double minPrice) const
+{
+    return getByPriceRange(minPrice, std::numeric_limits<double>::infinity());
+}
+
+BookView LibraryManager::getCheapBooks(double maxPrice) const
+{
+    return getByPriceRange(-std::numeric_limits<double>::infinity(), maxPrice);
+}
+
+BookView LibraryManager::getByPriceRange(double minPrice, double maxPrice) const
+{
+    return viewOf(priceIndex_.rows(minPrice, maxPrice));
+}
+
+QVector<int> LibraryManager::rowsByPriceRange(double minPrice, double maxPrice, int offset, int limit) const
+{
+    return priceIndex_.rows(minPrice, maxPrice, offset, limit);
+}
+
+int LibraryManager::countByPriceRange(double minPrice, double maxPrice) const
+{
+    return priceIndex_.count(minPrice, maxPrice);
+}
+
+BookView LibraryManager::query(const CatalogQuery &query) const
+{
+    return viewOf(queryRows(query));
+}
+
+QVector<int> LibraryManager::queryRows(const CatalogQuery &query) const
+{
+    const QueryPlanner planner(columns_, idIndex_, categoryIndex_, locationIndex_, priceIndex_, dueDateIndex_, textIndex_);
+    return planner.execute(query);
 }
 
 // 统计功能实现
 int LibraryManager::getTotalBooks() const
 {
-    return books_.size();
+    return columns_.size();
 }
 
 int LibraryManager::getAvailableBooks() const
 {
-    int count = 0;
-    for (const Book &book : books_) {
-        if (book.available && book.quantity > 0) {
-            count++;
-        }
-    }
-    return count;
+    return stats_.available;
 }
 
 int LibraryManager::getBorrowedBooks() const
 {
-    int count = 0;
-    for (const Book &book : books_) {
-        if (!book.available || book.quantity == 0) {
-            count++;
-        }
-    }
-    return count;
+    return stats_.borrowed;
 }
 
 int LibraryManager::getBooksByCategory(const QString &category) const
 {
-    int count = 0;
-    for (const Book &book : books_) {
-        if (book.category.contains(category, Qt::CaseInsensitive)) {
-            count++;
-        }
-    }
-    return count;
+    return categoryIndex_.countForCodes(columns_.categoryDictionary().codesContaining(category));
+}
+
+int LibraryManager::getBooksByLocation(const QString &location) const
+{
+    return locationIndex_.countForCodes(columns_.locationDictionary().codesContaining(location));
 }
 
 double LibraryManager::getTotalValue() const
 {
-    double total = 0.0;
-    for (const Book &book : books_) {
-        total += book.price * book.quantity;
-    }
-    return total;
+    return stats_.totalValue;
 }
 
 QString LibraryManager::getMostPopularCategory() const
 {
-    QMap<QString, int> categoryCount;
-    for (const Book &book : books_) {
-        categoryCount[book.category]++;
-    }
-    
-    QString mostPopular;
-    int maxCount = 0;
-    for (auto it = categoryCount.begin(); it != categoryCount.end(); ++it) {
-        if (it.value() > maxCount) {
-            maxCount = it.value();
-            mostPopular = it.key();
-        }
-    }
-    return mostPopular;
+    return mostFrequentValue(columns_.categoryDictionary(), categoryIndex_);
 }
 
 QString LibraryManager::getMostPopularLocation() const
 {
-    QMap<QString, int> locationCount;
-    for (const Book &book : books_) {
-        locationCount[book.location]++;
-    }
-    
-    QString mostPopular;
-    int maxCount = 0;
-    for (auto it = locationCount.begin(); it != locationCount.end(); ++it) {
-        if (it.value() > maxCount) {
-            maxCount = it.value();
-            mostPopular = it.key();
-        }
-    }
-    return mostPopular;
+    return mostFrequentValue(columns_.locationDictionary(), locationIndex_);
+}
+
+int LibraryManager::countByCategory(const QString &category) const
+{
+    return categoryIndex_.count(columns_.categoryDictionary().codeOf(category));
+}
+
+int LibraryManager::countByLocation(const QString &location) const
+{
+    return locationIndex_.count(columns_.locationDictionary().codeOf(location));
+}
+
+// 排序功能实现：只记下显示顺序，存储中的图书不移动；各顺序下的行号排列由
+// SortPermutations 首次使用时排出并缓存，之后随增删改增量维护
+void LibraryManager::setSortOrder(const SortSpec &spec)
+{
+    if (spec == sortOrder_) return;
+    emit sortOrderAboutToBeChanged();
+    sortOrder_ = spec;
+    sortPermutations_.setCurrent(spec, columns_);
+    emit sortOrderChanged();
+}
+
+const SortSpec &LibraryManager::sortOrder() const
+{
+    return sortOrder_;
+}
+
+int LibraryManager::displayRow(int position) const
+{
+    return sortPermutations_.currentRow(position);
+}
+
+int LibraryManager::displayPosition(int row) const
+{
+    return sortPermutations_.currentPosition(row);
+}
+
+QVector<int> LibraryManager::sortedRows(const SortSpec &spec) const
+{
+    return sortPermutations_.rows(spec, columns_);
 }
 
-// 排序功能实现
 void LibraryManager::sortByName()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.name < b.name;
-    });
+    setSortOrder({ SortKey{ QueryPredicate::NameField, Qt::AscendingOrder } });
 }
 
 void LibraryManager::sortByCategory()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.category < b.category;
-    });
+    setSortOrder({ SortKey{ QueryPredicate::CategoryField, Qt::AscendingOrder } });
 }
 
 void LibraryManager::sortByLocation()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.location < b.location;
-    });
+    setSortOrder({ SortKey{ QueryPredicate::LocationField, Qt::AscendingOrder } });
 }
 
 void LibraryManager::sortByPrice()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.price > b.price;
-    });
+    setSortOrder({ SortKey{ QueryPredicate::PriceField, Qt::DescendingOrder } });
 }
 
 void LibraryManager::sortByDate()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.inDate > b.inDate;
-    });
+    setSortOrder({ SortKey{ QueryPredicate::InDateField, Qt::DescendingOrder } });
 }
 
 void LibraryManager::sortByBorrowCount()
 {
-    std::sort(books_.begin(), books_.end(), [](const Book &a, const Book &b){
-        return a.borrowCount > b.borrowCount;
-    });
+    setSortOrder({ SortKey{ QueryPredicate::BorrowCountField, Qt::DescendingOrder } });
 }
-
-
@@ -2,59 +2,161 @@
 #define LIBRARYMANAGER_H
 
 #include <QObject>
+#include <QThreadPool>
 #include <QVector>
+#include <QHash>
 #include <QString>
+#include <QStringList>
 #include <QDate>
 
 #include "book.h"
+#include "bookview.h"
+#include "catalogcolumns.h"
+#include "postinglistindex.h"
+#include "priceindex.h"
+#include "duedateindex.h"
+#include "borrowrankindex.h"
+#include "ngramindex.h"
+#include "pinyinindex.h"
+#include "autocompletetrie.h"
+#include "searchsnapshot.h"
+#include "catalogquery.h"
+#include "sortpermutations.h"
+
+class CirculationJournal;
+class QTimer;
 
 // 负责内存中的图书集合与文件持久化
+// 图书按列存放在 CatalogColumns 中（见 catalogcolumns.h），需要完整图书时按行组装
 class LibraryManager : public QObject {
     Q_OBJECT
 public:
     explicit LibraryManager(QObject *parent = nullptr);
+    ~LibraryManager() override;
 
     // 文件 I/O
     bool loadFromFile(const QString &filePath, QString *errorMessage = nullptr);
     bool saveToFile(const QString &filePath, QString *errorMessage = nullptr) const;
+    // 后台保存：取当前目录的隐式共享快照，在工作线程序列化并通过 QSaveFile 写入，
+    // 完成后发出 saveFinished；保存期间可以继续借还。返回本次保存的编号，saveFinished 原样带回，
+    // 同一文件先后排队的多次保存据此区分
+    quint64 saveToFileAsync(const QString &filePath);
+    // 二进制快照（见 catalogsnapshot.h），JSON 仍用于导入/导出
+    bool loadFromSnapshot(const QString &filePath, QString *errorMessage = nullptr);
+    bool saveToSnapshot(const QString &filePath, QString *errorMessage = nullptr) const;
+    quint64 saveToSnapshotAsync(const QString &filePath);
+    static bool convertJsonToSnapshot(const QString &jsonPath, const QString &snapshotPath, QString *errorMessage = nullptr);
+    static bool convertSnapshotToJson(const QString &snapshotPath, const QString &jsonPath, QString *errorMessage = nullptr);
+
+    // 持久化存储：快照 + 借还日志（见 circulationjournal.h）
+    // 打开时加载快照并重放日志；之后每次增删改、借还只向日志追加一条记录
+    bool openStore(const QString &snapshotPath, const QString &journalPath, QString *errorMessage = nullptr);
+    void closeStore();
+    bool isStoreOpen() const;
+    // 把当前目录写入快照并清空日志，限制下次启动需要重放的记录数。
+    // 在调用线程上同步写入（关闭存储时使用）；日志条数、定时器和加载触发的检查点走后台，见 startCheckpoint
+    bool checkpoint(QString *errorMessage = nullptr);
+    qint64 lastRecoveryMs() const;
+    int lastRecoveredEntries() const;
 
     // 基本操作
     bool addBook(const Book &book, QString *errorMessage = nullptr);
     bool removeBookByIndexId(const QString &indexId);
     bool updateBook(const QString &indexId, const Book &updated, QString *errorMessage = nullptr);
-    Book *findByName(const QString &name);
-    const Book *findByName(const QString &name) const;
+    // 按名称（不区分大小写）查找，返回第一本的行号，未找到返回 -1；走 n-gram 索引
+    int indexOfName(const QString &name) const;
 
     // 业务逻辑
     bool borrowBook(const QString &indexId, QDate dueDate, QString *errorMessage = nullptr);
     bool returnBook(const QString &indexId, QString *errorMessage = nullptr);
 
-    // 查询
-    QVector<Book> getAll() const;
-    QVector<Book> getDueInDays(int days) const;
+    // 按行访问：bookAt 组装整本图书；只需个别字段时直接读取 columns()
+    int count() const;
+    Book bookAt(int row) const;
+    int indexOf(const QString &indexId) const;
+    const CatalogColumns &columns() const;
+    // 目录版本：增删图书、加载等会改变行号的操作都会使其递增，
+    // 原地编辑、借还和排序不改变行号，不递增
+    quint64 catalogVersion() const;
+
+    // 查询：结果为行号视图（见 bookview.h），不复制图书；需要副本时调用 BookView::toBooks()
+    // 全部图书的视图不分配内存
+    BookView getAll() const;
+    // 到期查询走按日期分桶的借阅索引（见 duedateindex.h），结果按归还日期升序
+    BookView getDueInDays(int days) const;
+    QVector<int> rowsDueInDays(int days) const;
+    // 归还日期早于今天的借阅
+    BookView getOverdue() const;
+    QVector<int> rowsOverdue() const;
     void sortByBorrowCountDesc();
     
     // 新增实用功能
-    QVector<Book> getByCategory(const QString &category) const;
-    QVector<Book> getByLocation(const QString &location) const;
-    QVector<Book> getAvailable() const;
-    QVector<Book> getBorrowed() const;
-    QVector<Book> searchBooks(const QString &keyword) const;
-    QVector<Book> getTopBorrowed(int limit = 10) const;
-    QVector<Book> getRecentlyAdded(int days = 30) const;
-    QVector<Book> getExpensiveBooks(double minPrice) const;
-    QVector<Book> getCheapBooks(double maxPrice) const;
+    // 分类/馆藏地址筛选走倒排索引（见 postinglistindex.h），不扫描整个目录
+    BookView getByCategory(const QString &category) const;
+    BookView getByLocation(const QString &location) const;
+    QVector<int> rowsByCategory(const QString &category) const;
+    QVector<int> rowsByLocation(const QString &location) const;
+    // 排好序的不同分类/馆藏地址
+    QStringList categories() const;
+    QStringList locations() const;
+    // 以下筛选都是单列（或少数几列）上的顺序扫描，*Rows 版本只返回行号；
+    // 可借/已借出/新入库的数值比较由 columnkernels.h 的向量化内核生成位图
+    BookView getAvailable() const;
+    QVector<int> availableRows() const;
+    BookView getBorrowed() const;
+    QVector<int> borrowedRows() const;
+    // 关键字搜索走字符 n-gram 倒排索引（见 ngramindex.h），结果按匹配质量排序
+    BookView searchBooks(const QString &keyword) const;
+    QVector<int> searchRows(const QString &keyword) const;
+    // 搜索框用的综合检索：先是上面的子串匹配，再补上书名的拼音/首字母前缀匹配
+    // 和容错匹配（见 pinyinindex.h），各组之间去重；limit < 0 表示不限
+    BookView fuzzySearch(const QString &keyword, int limit = -1) const;
+    QVector<int> fuzzySearchRows(const QString &keyword, int limit = -1) const;
+    // 检索索引的只读副本，供工作线程检索（见 searchsnapshot.h、queryexecutor.h）
+    SearchSnapshot searchSnapshot() const;
+    // 搜索框自动补全：以 prefix 开头的书名/索引号，借阅次数高的在前（见 autocompletetrie.h）
+    QStringList suggestions(const QString &prefix, int limit = 10) const;
+    // 热门图书走借阅次数排行索引（见 borrowrankindex.h），代价 O(K)；limit <= 0 返回全部
+    BookView getTopBorrowed(int limit = 10) const;
+    QVector<int> topBorrowedRows(int limit = 10) const;
+    BookView getRecentlyAdded(int days = 30) const;
+    QVector<int> recentlyAddedRows(int days = 30) const;
+    BookView getExpensiveBooks(double minPrice) const;
+    BookView getCheapBooks(double maxPrice) const;
+    // 价格区间查询（闭区间）走价格有序索引，结果按价格升序
+    BookView getByPriceRange(double minPrice, double maxPrice) const;
+    // 只返回行号，用于分页读取：第 offset 条起最多 limit 条，limit < 0 表示不限
+    QVector<int> rowsByPriceRange(double minPrice, double maxPrice, int offset = 0, int limit = -1) const;
+    int countByPriceRange(double minPrice, double maxPrice) const;
+    // 组合查询（见 catalogquery.h）：多个条件一次求值，由 QueryPlanner 挑选最有选择性的索引
+    // 或在整列上向量化扫描（见 queryplanner.h），结果按查询排序、分页
+    BookView query(const CatalogQuery &query) const;
+    QVector<int> queryRows(const CatalogQuery &query) const;
     
-    // 统计功能
+    // 统计功能：计数与总价值由每次变更增量维护，分类/馆藏地址计数取自倒排索引，均不扫描目录
     int getTotalBooks() const;
     int getAvailableBooks() const;
     int getBorrowedBooks() const;
     int getBooksByCategory(const QString &category) const;
+    int getBooksByLocation(const QString &location) const;
     double getTotalValue() const;
     QString getMostPopularCategory() const;
     QString getMostPopularLocation() const;
+    // 分类/馆藏地址完全相同的图书数
+    int countByCategory(const QString &category) const;
+    int countByLocation(const QString &location) const;
     
-    // 排序功能
+    // 排序功能：只选择显示顺序，不移动存储中的图书，行号与此前取得的视图保持有效。
+    // 每种顺序的行号排列首次使用时排出并缓存，之后随增删改、借还增量维护（见 sortpermutations.h）
+    void setSortOrder(const SortSpec &spec);
+    // 当前的显示顺序，为空表示按存储顺序
+    const SortSpec &sortOrder() const;
+    // 当前显示顺序下第 position 位的行号、第 row 行所在的位置，直接查缓存的排列（见 sortpermutations.h）
+    int displayRow(int position) const;
+    int displayPosition(int row) const;
+    // 按 spec 排好序的全部行号；spec 为空时按存储顺序
+    QVector<int> sortedRows(const SortSpec &spec) const;
+    // 书名按拼音排序（见 ChineseText::sortKey）
     void sortByName();
     void sortByCategory();
     void sortByLocation();
@@ -62,11 +164,88 @@ public:
     void sortByDate();
     void sortByBorrowCount();
 
+signals:
+    // 细粒度变更通知，row 为变更发生时图书在 LibraryManager 中的行号
+    void bookAboutToBeInserted(int row, const QString &indexId);
+    void bookInserted(int row, const QString &indexId);
+    void bookChanged(int row, const QString &indexId);
+    // 编辑或借还使第 row 行在当前显示顺序中换了位置，在对应的 bookChanged 之前发出
+    void bookMoved(int row, int fromPosition, int toPosition);
+    void bookAboutToBeRemoved(int row, const QString &indexId);
+    void bookRemoved(int row, const QString &indexId);
+    // 加载等整体替换目录时发出，此前的行号全部失效
+    void catalogAboutToBeReset();
+    void catalogReset();
+    // loadFromFile 读取过程中按批次报告进度
+    void loadProgress(int records, qint64 bytesRead, qint64 totalBytes);
+    // 日志写入或检查点失败
+    void storeError(const QString &message);
+    // saveToFileAsync / saveToSnapshotAsync 完成
+    void saveFinished(quint64 saveId, const QString &filePath, bool ok, const QString &errorMessage);
+    // setSortOrder 改变显示顺序的前后
+    void sortOrderAboutToBeChanged();
+    void sortOrderChanged();
+    // 跨过零点时发出，rows 为刚刚变为逾期的图书行号
+    void booksBecameOverdue(const QVector<int> &rows);
+
 private:
     int findIndexById(const QString &indexId) const;
+    // 索引维护：columns_ 整体替换（加载）后调用 rebuildIndexes，单本增删改后调用对应的增量函数；
+    // 删除和编辑需要传入变更前的图书及其分类/馆藏地址编码
+    void rebuildIndexes();
+    void indexInsertedBook(int row);
+    void indexRemovedBook(int row, const Book &removed, int categoryCode, int locationCode);
+    void indexUpdatedBook(int row, const Book &before, int categoryCode, int locationCode);
+    void indexCirculationChange(int row, const Book &before);
+    // sign 为 1 计入、-1 扣除一本图书
+    void addToStatistics(const Book &b, int sign);
+    void addToStatistics(int quantity, double price, bool available, int sign);
+    void recomputeStatistics();
+    BookView viewOf(const QVector<int> &rows) const;
+    static QString mostFrequentValue(const StringDictionary &dictionary, const PostingListIndex &index);
+    static QStringList usedValues(const StringDictionary &dictionary, const PostingListIndex &index);
+    void afterJournalAppend();
+    // 在保存线程上把此刻的目录写入快照，完成后只丢弃快照已包含的日志记录
+    void startCheckpoint();
+    void scheduleDayBoundary();
+    void onDayBoundary();
+    quint64 startAsyncSave(const QString &filePath, bool snapshot);
+    static bool writeJsonFile(const QString &filePath, const QVector<Book> &books, QString *errorMessage);
 
 private:
-    QVector<Book> books_;
+    CatalogColumns columns_;
+    quint64 catalogVersion_ = 0;
+    quint64 lastSaveId_ = 0;
+    QHash<QString, int> idIndex_;   // indexId -> 行号，columns_ 每次变动后同步维护
+    PostingListIndex categoryIndex_;
+    PostingListIndex locationIndex_;
+    PriceIndex priceIndex_;
+    DueDateIndex dueDateIndex_;
+    BorrowRankIndex borrowRankIndex_;
+    NGramIndex textIndex_;
+    PinyinIndex pinyinIndex_;
+    AutocompleteTrie suggestionTrie_;
+    SortSpec sortOrder_;
+    mutable SortPermutations sortPermutations_;   // 当前顺序常驻，其余按需排出，const 查询中也会填充
+
+    struct Statistics {
+        int available = 0;
+        int borrowed = 0;
+        double totalValue = 0.0;   // 每次整体重建时重新求和，消除增减累积的舍入误差
+    };
+    Statistics stats_;
+    QTimer *dayTimer_ = nullptr;
+    QDate overdueCheckedDay_;   // 该日之前到期的借阅已通过 booksBecameOverdue 报告
+
+    CirculationJournal *journal_ = nullptr;
+    QTimer *checkpointTimer_ = nullptr;
+    QString snapshotPath_;
+    int checkpointsInFlight_ = 0;
+    quint64 storeGeneration_ = 0;   // 每次关闭存储时递增，作废尚未回到界面线程的检查点
+    qint64 lastRecoveryMs_ = 0;
+    int lastRecoveredEntries_ = 0;
+
+    QThreadPool saveThreadPool_;
 };
 
 #endif // LIBRARYMANAGER_H
@@ -1,10 +1,10 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
+#include "catalogsnapshot.h"
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QTableView>
 #include <QAbstractItemView>
-#include <QStandardItemModel>
 #include <QToolBar>
 #include <QInputDialog>
 #include <QDate>
@@ -17,11 +17,29 @@
 #include <QLineEdit>
 #include <QPushButton>
 #include <QHBoxLayout>
-#include <QSet>
 #include <QDateTime>
 #include <QMenuBar>
 #include <QMenu>
 #include <QAction>
+#include <QProgressDialog>
+#include <QStandardPaths>
+#include <QDir>
+#include <QCompleter>
+#include <QStringListModel>
+#include <QDialog>
+#include <QDialogButtonBox>
+#include <QFormLayout>
+#include <QComboBox>
+#include <QSpinBox>
+#include <QDoubleSpinBox>
+#include <QCheckBox>
+#include <limits>
+
+namespace {
+const int kLiveSearchDelayMs = 150;   // 停止输入这么久后才检索，连续按键只检索一次（由 QueryExecutor 去抖）
+const int kLiveSearchLimit = 200;     // 边输入边检索时最多显示的条数
+const int kSuggestionLimit = 10;      // 自动补全列表的条数
+} // namespace
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -35,10 +53,15 @@ MainWindow::MainWindow(QWidget *parent)
 {
     ui->setupUi(this);
     setupTable();
+    connect(&library_, &LibraryManager::saveFinished, this, &MainWindow::onSaveFinished);
+    connect(&library_, &LibraryManager::booksBecameOverdue, this, [this](const QVector<int> &rows) {
+        statusBar()->showMessage(QStringLiteral("⚠️ 今天新增 %1 本逾期未还的图书").arg(rows.size()), 5000);
+    });
     setupMenuBar();
     setupActions();
     setupSearchBar();
     setupThemeToggle();
+    openLocalStore();
     initializeSampleBooks();
     setupStyles();
 }
@@ -50,13 +73,7 @@ MainWindow::~MainWindow()
 
 void MainWindow::setupTable()
 {
-    model_ = new QStandardItemModel(this);
-    model_->setHorizontalHeaderLabels({
-        QStringLiteral("索引号"), QStringLiteral("名称"), QStringLiteral("馆藏地址"),
-        QStringLiteral("类别"), QStringLiteral("数量"), QStringLiteral("价格"),
-        QStringLiteral("入库日期"), QStringLiteral("归还日期"), QStringLiteral("借阅次数"),
-        QStringLiteral("状态")
-    });
+    model_ = new BookTableModel(&library_, this);
     
     // 创建表格视图
     tableView_ = new QTableView(this);
@@ -81,33 +98,44 @@ void MainWindow::setupTable()
     ui->centralLayout->addWidget(tableView_);
 }
 
-void MainWindow::refreshTable(const QVector<Book> &books)
-{
-    model_->removeRows(0, model_->rowCount());
-    model_->setRowCount(books.size());
-    for (int row = 0; row < books.size(); ++row) {
-        const Book &b = books[row];
-        model_->setItem(row, 0, new QStandardItem(b.indexId));
-        model_->setItem(row, 1, new QStandardItem(b.name));
-        model_->setItem(row, 2, new QStandardItem(b.location));
-        model_->setItem(row, 3, new QStandardItem(b.category));
-        model_->setItem(row, 4, new QStandardItem(QString::number(b.quantity)));
-        model_->setItem(row, 5, new QStandardItem(QString::number(b.price, 'f', 2)));
-        model_->setItem(row, 6, new QStandardItem(b.inDate.isValid() ? b.inDate.toString(Qt::ISODate) : QString()));
-        model_->setItem(row, 7, new QStandardItem(b.returnDate.isValid() ? b.returnDate.toString(Qt::ISODate) : QString()));
-        model_->setItem(row, 8, new QStandardItem(QString::number(b.borrowCount)));
-        model_->setItem(row, 9, new QStandardItem(b.available ? QStringLiteral("✅ 可借") : QStringLiteral("❌ 不可借")));
-    }
-    
-    // 更新状态栏信息
-    int totalBooks = books.size();
+void MainWindow::refreshTable()
+{
+    // 切换到其他视图时，尚未交付的检索结果不再需要
+    if (queryExecutor_) queryExecutor_->cancel();
+    model_->showAll();
+    updateTableStatus();
+}
+
+void MainWindow::refreshTable(const BookView &view)
+{
+    if (queryExecutor_) queryExecutor_->cancel();
+    model_->showView(view);
+    updateTableStatus();
+}
+
+void MainWindow::refreshTableRows(const QVector<int> &rows)
+{
+    if (queryExecutor_) queryExecutor_->cancel();
+    model_->showRows(rows);
+    updateTableStatus();
+}
+
+void MainWindow::updateTableStatus()
+{
+    // 更新状态栏信息：显示全部时直接取 LibraryManager 维护的计数，查询结果只统计结果行
+    int totalBooks = model_->rowCount();
     int availableBooks = 0;
     int borrowedBooks = 0;
-    for (const auto &book : books) {
-        if (book.available) {
-            availableBooks++;
-        } else {
-            borrowedBooks++;
+    if (model_->isShowingAll()) {
+        availableBooks = library_.getAvailableBooks();
+        borrowedBooks = library_.getBorrowedBooks();
+    } else {
+        for (int row = 0; row < totalBooks; ++row) {
+            if (library_.columns().available(model_->libraryRow(row))) {
+                availableBooks++;
+            } else {
+                borrowedBooks++;
+            }
         }
     }
     
@@ -116,6 +144,21 @@ void MainWindow::refreshTable(const QVector<Book> &books)
     statusBar()->showMessage(statusText);
 }
 
+bool MainWindow::loadCatalog(const QString &path, QString *errorMessage)
+{
+    // 大文件加载时显示进度；在 minimumDuration 内完成的小文件不会弹出对话框
+    QProgressDialog progress(QStringLiteral("📂 正在加载图书数据..."), QString(), 0, 1000, this);
+    progress.setWindowModality(Qt::WindowModal);
+    progress.setMinimumDuration(500);
+    connect(&library_, &LibraryManager::loadProgress, &progress,
+            [&progress](int records, qint64 bytesRead, qint64 totalBytes) {
+        progress.setLabelText(QStringLiteral("📂 正在加载图书数据... 已读取 %1 本").arg(records));
+        progress.setValue(totalBytes > 0 ? int(bytesRead * 1000 / totalBytes) : 0);
+    });
+    if (CatalogSnapshot::isSnapshotFile(path)) return library_.loadFromSnapshot(path, errorMessage);
+    return library_.loadFromFile(path, errorMessage);
+}
+
 void MainWindow::setupActions()
 {
     // 创建左侧工具栏
@@ -235,7 +278,8 @@ void MainWindow::onAdd()
             QMessageBox::warning(this, QStringLiteral("❌ 新增失败"), err);
             return;
         }
-        refreshTable(library_.getAll());
+        // 表格模型已通过 bookInserted 增量插入新行；查询结果视图则切回全部图书以便看到新书
+        if (!model_->isShowingAll()) refreshTable();
         statusBar()->showMessage(QStringLiteral("✅ 成功添加图书: %1").arg(b.name), 3000);
     }
 }
@@ -254,20 +298,18 @@ void MainWindow::onEdit()
         QMessageBox::information(this, QStringLiteral("ℹ️ 提示"), QStringLiteral("请先选择要编辑的图书"));
         return;
     }
-    const QString indexId = model_->item(idx.row(), 0)->text();
-    const auto all = library_.getAll();
-    int pos = -1;
-    for (int i = 0; i < all.size(); ++i) if (all[i].indexId == indexId) { pos = i; break; }
-    if (pos < 0) return;
+    const int row = model_->libraryRow(idx.row());
+    if (row < 0) return;
+    const Book current = library_.bookAt(row);
+    const QString indexId = current.indexId;
     BookDialog dlg(this);
-    dlg.setBook(all[pos]);
+    dlg.setBook(current);
     if (dlg.exec() == QDialog::Accepted) {
         QString err;
         if (!library_.updateBook(indexId, dlg.getBook(), &err)) {
             QMessageBox::warning(this, QStringLiteral("❌ 编辑失败"), err);
             return;
         }
-        refreshTable(library_.getAll());
         statusBar()->showMessage(QStringLiteral("✅ 成功编辑图书: %1").arg(dlg.getBook().name), 3000);
     }
 }
@@ -286,15 +328,17 @@ void MainWindow::onRemove()
         QMessageBox::information(this, QStringLiteral("ℹ️ 提示"), QStringLiteral("请先选择要删除的图书"));
         return;
     }
-    const QString indexId = model_->item(idx.row(), 0)->text();
-    const QString bookName = model_->item(idx.row(), 1)->text();
+    const int row = model_->libraryRow(idx.row());
+    if (row < 0) return;
+    const Book book = library_.bookAt(row);
+    const QString indexId = book.indexId;
+    const QString bookName = book.name;
     
     auto reply = QMessageBox::question(this, QStringLiteral("⚠️ 确认删除"), 
                                       QStringLiteral("确定要删除图书 \"%1\" 吗？").arg(bookName),
                                       QMessageBox::Yes | QMessageBox::No);
     if (reply == QMessageBox::Yes) {
         if (library_.removeBookByIndexId(indexId)) {
-            refreshTable(library_.getAll());
             statusBar()->showMessage(QStringLiteral("✅ 成功删除图书: %1").arg(bookName), 3000);
         } else {
             QMessageBox::warning(this, QStringLiteral("❌ 删除失败"), QStringLiteral("删除图书时发生错误"));
@@ -310,11 +354,14 @@ void MainWindow::onBorrow()
         QMessageBox::information(this, QStringLiteral("ℹ️ 提示"), QStringLiteral("请先选择要借阅的图书"));
         return;
     }
-    const QString indexId = model_->item(idx.row(), 0)->text();
-    const QString bookName = model_->item(idx.row(), 1)->text();
+    const int row = model_->libraryRow(idx.row());
+    if (row < 0) return;
+    const Book book = library_.bookAt(row);
+    const QString indexId = book.indexId;
+    const QString bookName = book.name;
     
     // 检查图书是否可借
-    if (model_->item(idx.row(), 9)->text().contains("❌")) {
+    if (!book.available) {
         QMessageBox::warning(this, QStringLiteral("❌ 借书失败"), QStringLiteral("该图书已被借出，无法再次借阅"));
         return;
     }
@@ -335,7 +382,6 @@ void MainWindow::onBorrow()
         QMessageBox::warning(this, QStringLiteral("❌ 借书失败"), err);
         return;
     }
-    refreshTable(library_.getAll());
     statusBar()->showMessage(QStringLiteral("✅ 成功借阅图书: %1，归还日期: %2").arg(bookName, dueStr), 3000);
 }
 
@@ -347,11 +393,14 @@ void MainWindow::onReturn()
         QMessageBox::information(this, QStringLiteral("ℹ️ 提示"), QStringLiteral("请先选择要归还的图书"));
         return;
     }
-    const QString indexId = model_->item(idx.row(), 0)->text();
-    const QString bookName = model_->item(idx.row(), 1)->text();
+    const int row = model_->libraryRow(idx.row());
+    if (row < 0) return;
+    const Book book = library_.bookAt(row);
+    const QString indexId = book.indexId;
+    const QString bookName = book.name;
     
     // 检查图书是否已借出
-    if (model_->item(idx.row(), 9)->text().contains("✅")) {
+    if (book.available) {
         QMessageBox::warning(this, QStringLiteral("❌ 还书失败"), QStringLiteral("该图书未被借出，无需归还"));
         return;
     }
@@ -365,7 +414,6 @@ void MainWindow::onReturn()
             QMessageBox::warning(this, QStringLiteral("❌ 还书失败"), err);
             return;
         }
-        refreshTable(library_.getAll());
         statusBar()->showMessage(QStringLiteral("✅ 成功归还图书: %1").arg(bookName), 3000);
     }
 }
@@ -374,70 +422,112 @@ void MainWindow::onSearch()
 {
     if (!searchEdit_) return;
     
-    const QString name = searchEdit_->text().trimmed();
-    if (name.isEmpty()) {
+    const QString keyword = searchEdit_->text().trimmed();
+    if (keyword.isEmpty()) {
         QMessageBox::information(this, QStringLiteral("ℹ️ 提示"), QStringLiteral("请输入要搜索的图书名称"));
         return;
     }
     
-    const Book *b = library_.findByName(name);
-    if (!b) {
+    // 支持书名子串、拼音全拼/首字母和少量错字；在工作线程检索，结果由 onSearchResults 显示
+    explicitSearch_ = queryExecutor_->submit(keyword, QueryExecutor::FuzzyMode);
+}
+
+void MainWindow::onSearchTextEdited(const QString &text)
+{
+    const QString prefix = text.trimmed();
+    suggestionModel_->setStringList(prefix.isEmpty() ? QStringList() : library_.suggestions(prefix, kSuggestionLimit));
+    if (prefix.isEmpty()) {
+        refreshTable();
+        return;
+    }
+    searchEdit_->completer()->complete();
+    queryExecutor_->submitDebounced(prefix, QueryExecutor::FuzzyMode, kLiveSearchLimit);
+}
+
+void MainWindow::onSearchResults(quint64 generation, const QString &keyword, const QVector<int> &rows)
+{
+    const bool isExplicit = generation == explicitSearch_;
+    explicitSearch_ = 0;
+    if (isExplicit && rows.isEmpty()) {
         QMessageBox::information(this, QStringLiteral("ℹ️ 未找到"), 
-                                QStringLiteral("没有找到名称为 \"%1\" 的图书").arg(name));
+                                QStringLiteral("没有找到与 \"%1\" 匹配的图书").arg(keyword));
         return;
     }
-    refreshTable(QVector<Book>{ *b });
-    statusBar()->showMessage(QStringLiteral("🔍 搜索到图书: %1").arg(b->name), 3000);
+    // 不经过 refreshTableRows，以免作废刚交付的查询
+    model_->showRows(rows);
+    updateTableStatus();
+    if (isExplicit) {
+        statusBar()->showMessage(QStringLiteral("🔍 搜索到 %1 本相关图书").arg(rows.size()), 3000);
+    } else {
+        statusBar()->showMessage(QStringLiteral("🔍 \"%1\"：%2 本相关图书").arg(keyword).arg(rows.size()), 3000);
+    }
 }
 
 void MainWindow::onShowDue()
 {
-    auto dueBooks = library_.getDueInDays(3);
-    refreshTable(dueBooks);
-    if (dueBooks.isEmpty()) {
+    const QVector<int> dueRows = library_.rowsDueInDays(3);
+    refreshTableRows(dueRows);
+    if (dueRows.isEmpty()) {
         statusBar()->showMessage(QStringLiteral("ℹ️ 没有3天内到期的图书"), 3000);
     } else {
-        statusBar()->showMessage(QStringLiteral("⏰ 显示 %1 本3天内到期的图书").arg(dueBooks.size()), 3000);
+        statusBar()->showMessage(QStringLiteral("⏰ 显示 %1 本3天内到期的图书").arg(dueRows.size()), 3000);
     }
 }
 
 void MainWindow::onSortByBorrow()
 {
     library_.sortByBorrowCountDesc();
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("📊 已按借阅次数降序排列"), 3000);
 }
 
 void MainWindow::onOpen()
 {
     const QString path = QFileDialog::getOpenFileName(this, QStringLiteral("📂 打开文件"), QString(), 
-                                                     QStringLiteral("JSON 文件 (*.json);;所有文件 (*.*)"));
+                                                     QStringLiteral("JSON 文件 (*.json);;图书快照 (*.njlib);;所有文件 (*.*)"));
     if (path.isEmpty()) return;
     QString err;
-    if (!library_.loadFromFile(path, &err)) {
+    if (!loadCatalog(path, &err)) {
         QMessageBox::warning(this, QStringLiteral("❌ 打开失败"), err);
         return;
     }
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("✅ 成功打开文件: %1").arg(QFileInfo(path).fileName()), 3000);
 }
 
 void MainWindow::onSave()
 {
     const QString path = QFileDialog::getSaveFileName(this, QStringLiteral("💾 保存文件"), QString(), 
-                                                     QStringLiteral("JSON 文件 (*.json);;所有文件 (*.*)"));
+                                                     QStringLiteral("JSON 文件 (*.json);;图书快照 (*.njlib);;所有文件 (*.*)"));
     if (path.isEmpty()) return;
-    QString err;
-    if (!library_.saveToFile(path, &err)) {
-        QMessageBox::warning(this, QStringLiteral("❌ 保存失败"), err);
-        return;
+    const bool snapshot = QFileInfo(path).suffix().compare(QStringLiteral("njlib"), Qt::CaseInsensitive) == 0;
+    saveCatalogAsync(path, snapshot, QStringLiteral("✅ 成功保存文件: %1").arg(QFileInfo(path).fileName()),
+                     QStringLiteral("❌ 保存失败"));
+}
+
+void MainWindow::saveCatalogAsync(const QString &path, bool snapshot, const QString &successMessage, const QString &failureTitle)
+{
+    // 序列化和写盘在 LibraryManager 的工作线程进行，界面不等待；结果由 onSaveFinished 报告
+    const quint64 saveId = snapshot ? library_.saveToSnapshotAsync(path) : library_.saveToFileAsync(path);
+    pendingSaves_.insert(saveId, PendingSave{ successMessage, failureTitle });
+    statusBar()->showMessage(QStringLiteral("⏳ 正在保存: %1").arg(QFileInfo(path).fileName()));
+}
+
+void MainWindow::onSaveFinished(quint64 saveId, const QString &filePath, bool ok, const QString &errorMessage)
+{
+    Q_UNUSED(filePath);
+    const PendingSave pending = pendingSaves_.take(saveId);
+    if (ok) {
+        statusBar()->showMessage(pending.successMessage, 3000);
+    } else {
+        statusBar()->clearMessage();
+        QMessageBox::warning(this, pending.failureTitle, errorMessage);
     }
-    statusBar()->showMessage(QStringLiteral("✅ 成功保存文件: %1").arg(QFileInfo(path).fileName()), 3000);
 }
 
 void MainWindow::onShowAll()
 {
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("📋 显示所有图书"), 3000);
 }
 
@@ -474,6 +564,11 @@ bool MainWindow::isAdminMode() const
     return adminMode_;
 }
 
+void MainWindow::setTopBorrowedLimit(int limit)
+{
+    topBorrowedLimit_ = qMax(1, limit);
+}
+
 QString MainWindow::getCurrentUser() const
 {
     return currentUser_;
@@ -565,7 +660,15 @@ void MainWindow::setupSearchBar()
     
     // 创建搜索输入框
     searchEdit_ = new QLineEdit();
-    searchEdit_->setPlaceholderText("🔍 搜索图书名称...");
+    searchEdit_->setPlaceholderText("🔍 搜索书名、拼音或首字母...");
+    queryExecutor_ = new QueryExecutor(&library_, this);
+    queryExecutor_->setDebounceInterval(kLiveSearchDelayMs);
+    // 补全列表每次按键由 LibraryManager 的前缀树直接给出，QCompleter 只负责显示，不再自行过滤
+    suggestionModel_ = new QStringListModel(this);
+    QCompleter *completer = new QCompleter(suggestionModel_, this);
+    completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    completer->setMaxVisibleItems(kSuggestionLimit);
+    searchEdit_->setCompleter(completer);
     
     // 创建搜索按钮
     searchButton_ = new QPushButton("搜索");
@@ -591,6 +694,9 @@ void MainWindow::setupSearchBar()
     // 连接信号
     connect(searchButton_, &QPushButton::clicked, this, &MainWindow::onSearch);
     connect(searchEdit_, &QLineEdit::returnPressed, this, &MainWindow::onSearch);
+    connect(searchEdit_, &QLineEdit::textEdited, this, &MainWindow::onSearchTextEdited);
+    connect(queryExecutor_, &QueryExecutor::resultsReady, this, &MainWindow::onSearchResults);
+    connect(completer, qOverload<const QString &>(&QCompleter::activated), this, &MainWindow::onSearch);
     connect(themeToggleButton_, &QPushButton::clicked, this, &MainWindow::toggleTheme);
 }
 
@@ -931,10 +1037,31 @@ QString MainWindow::getThemeStyles(bool isDark)
     }
 }
 
+void MainWindow::openLocalStore()
+{
+    // 本地数据目录中的快照 + 借还日志：启动时恢复上次退出（或崩溃）前的状态
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dir);
+    connect(&library_, &LibraryManager::storeError, this, [this](const QString &message) {
+        statusBar()->showMessage(QStringLiteral("⚠️ %1").arg(message), 5000);
+    });
+
+    QString err;
+    if (!library_.openStore(dir + QStringLiteral("/catalog.njlib"), dir + QStringLiteral("/circulation.journal"), &err)) {
+        QMessageBox::warning(this, QStringLiteral("⚠️ 数据恢复失败"), err);
+        return;
+    }
+    refreshTable();
+    if (library_.lastRecoveredEntries() > 0) {
+        statusBar()->showMessage(QStringLiteral("🔄 已从借还日志恢复 %1 条操作，用时 %2 ms")
+                                 .arg(library_.lastRecoveredEntries()).arg(library_.lastRecoveryMs()), 3000);
+    }
+}
+
 void MainWindow::initializeSampleBooks()
 {
     // 检查是否已有图书数据，如果有则不添加示例数据
-    if (!library_.getAll().isEmpty()) {
+    if (library_.count() > 0) {
         return;
     }
     
@@ -996,7 +1123,7 @@ void MainWindow::initializeSampleBooks()
     }
     
     // 刷新表格显示
-    refreshTable(library_.getAll());
+    refreshTable();
     
     // 更新状态栏
     statusBar()->showMessage(QStringLiteral("📚 已加载 %1 本示例图书").arg(sampleBooks.size()), 3000);
@@ -1090,6 +1217,7 @@ void MainWindow::setupMenuBar()
     QAction *showDueAction = queryMenu_->addAction("⏰ 到期提醒");
     queryMenu_->addSeparator();
     QAction *advancedSearchAction = queryMenu_->addAction("🔍 高级搜索");
+    QAction *combinedFilterAction = queryMenu_->addAction("🧩 组合筛选");
     
     // 连接信号
     connect(searchAction, &QAction::triggered, this, &MainWindow::onSearch);
@@ -1103,6 +1231,7 @@ void MainWindow::setupMenuBar()
     connect(showCheapAction, &QAction::triggered, this, &MainWindow::onShowCheapBooks);
     connect(showDueAction, &QAction::triggered, this, &MainWindow::onShowDue);
     connect(advancedSearchAction, &QAction::triggered, this, &MainWindow::onAdvancedSearch);
+    connect(combinedFilterAction, &QAction::triggered, this, &MainWindow::onCombinedFilter);
     
     // 3. 排序功能菜单
     sortMenu_ = menuBar_->addMenu("📊 排序功能");
@@ -1113,6 +1242,7 @@ void MainWindow::setupMenuBar()
     QAction *sortByPriceAction = sortMenu_->addAction("💵 按价格排序");
     QAction *sortByDateAction = sortMenu_->addAction("📅 按日期排序");
     QAction *sortByBorrowAction = sortMenu_->addAction("📈 按借阅排序");
+    QAction *sortByCategoryNameAction = sortMenu_->addAction("🗂️ 按分类+名称排序");
     
     // 连接信号
     connect(sortByNameAction, &QAction::triggered, this, &MainWindow::onSortByName);
@@ -1121,6 +1251,7 @@ void MainWindow::setupMenuBar()
     connect(sortByPriceAction, &QAction::triggered, this, &MainWindow::onSortByPrice);
     connect(sortByDateAction, &QAction::triggered, this, &MainWindow::onSortByDate);
     connect(sortByBorrowAction, &QAction::triggered, this, &MainWindow::onSortByBorrowCount);
+    connect(sortByCategoryNameAction, &QAction::triggered, this, &MainWindow::onSortByCategoryAndName);
     
     // 4. 数据管理菜单
     dataMenu_ = menuBar_->addMenu("💾 数据管理");
@@ -1174,82 +1305,60 @@ void MainWindow::setupMenuBar()
 // 新增实用功能实现
 void MainWindow::onFilterByCategory()
 {
-    QStringList categories;
-    QVector<Book> allBooks = library_.getAll();
-    QSet<QString> uniqueCategories;
-    
-    for (const Book &book : allBooks) {
-        uniqueCategories.insert(book.category);
-    }
-    
-    for (const QString &category : uniqueCategories) {
-        categories << category;
-    }
-    categories.sort();
+    const QStringList categories = library_.categories();
     
     bool ok;
     QString category = QInputDialog::getItem(this, QStringLiteral("📂 按分类筛选"), 
                                             QStringLiteral("请选择要筛选的分类:"), 
                                             categories, 0, false, &ok);
     if (ok && !category.isEmpty()) {
-        QVector<Book> filteredBooks = library_.getByCategory(category);
-        refreshTable(filteredBooks);
-        statusBar()->showMessage(QStringLiteral("📂 显示分类 '%1' 的图书，共 %2 本").arg(category).arg(filteredBooks.size()), 3000);
+        const BookView filtered = library_.getByCategory(category);
+        refreshTable(filtered);
+        statusBar()->showMessage(QStringLiteral("📂 显示分类 '%1' 的图书，共 %2 本").arg(category).arg(filtered.size()), 3000);
     }
 }
 
 void MainWindow::onFilterByLocation()
 {
-    QStringList locations;
-    QVector<Book> allBooks = library_.getAll();
-    QSet<QString> uniqueLocations;
-    
-    for (const Book &book : allBooks) {
-        uniqueLocations.insert(book.location);
-    }
-    
-    for (const QString &location : uniqueLocations) {
-        locations << location;
-    }
-    locations.sort();
+    const QStringList locations = library_.locations();
     
     bool ok;
     QString location = QInputDialog::getItem(this, QStringLiteral("📍 按位置筛选"), 
                                             QStringLiteral("请选择要筛选的位置:"), 
                                             locations, 0, false, &ok);
     if (ok && !location.isEmpty()) {
-        QVector<Book> filteredBooks = library_.getByLocation(location);
-        refreshTable(filteredBooks);
-        statusBar()->showMessage(QStringLiteral("📍 显示位置 '%1' 的图书，共 %2 本").arg(location).arg(filteredBooks.size()), 3000);
+        const BookView filtered = library_.getByLocation(location);
+        refreshTable(filtered);
+        statusBar()->showMessage(QStringLiteral("📍 显示位置 '%1' 的图书，共 %2 本").arg(location).arg(filtered.size()), 3000);
     }
 }
 
 void MainWindow::onShowAvailable()
 {
-    QVector<Book> availableBooks = library_.getAvailable();
-    refreshTable(availableBooks);
-    statusBar()->showMessage(QStringLiteral("✅ 显示可借图书，共 %1 本").arg(availableBooks.size()), 3000);
+    const QVector<int> rows = library_.availableRows();
+    refreshTableRows(rows);
+    statusBar()->showMessage(QStringLiteral("✅ 显示可借图书，共 %1 本").arg(rows.size()), 3000);
 }
 
 void MainWindow::onShowBorrowed()
 {
-    QVector<Book> borrowedBooks = library_.getBorrowed();
-    refreshTable(borrowedBooks);
-    statusBar()->showMessage(QStringLiteral("📖 显示已借图书，共 %1 本").arg(borrowedBooks.size()), 3000);
+    const QVector<int> rows = library_.borrowedRows();
+    refreshTableRows(rows);
+    statusBar()->showMessage(QStringLiteral("📖 显示已借图书，共 %1 本").arg(rows.size()), 3000);
 }
 
 void MainWindow::onShowTopBorrowed()
 {
-    QVector<Book> topBooks = library_.getTopBorrowed(10);
-    refreshTable(topBooks);
-    statusBar()->showMessage(QStringLiteral("🔥 显示热门图书前10名，共 %1 本").arg(topBooks.size()), 3000);
+    const QVector<int> topRows = library_.topBorrowedRows(topBorrowedLimit_);
+    refreshTableRows(topRows);
+    statusBar()->showMessage(QStringLiteral("🔥 显示热门图书前%1名，共 %2 本").arg(topBorrowedLimit_).arg(topRows.size()), 3000);
 }
 
 void MainWindow::onShowRecentlyAdded()
 {
-    QVector<Book> recentBooks = library_.getRecentlyAdded(30);
-    refreshTable(recentBooks);
-    statusBar()->showMessage(QStringLiteral("🆕 显示最近30天新增图书，共 %1 本").arg(recentBooks.size()), 3000);
+    const QVector<int> rows = library_.recentlyAddedRows(30);
+    refreshTableRows(rows);
+    statusBar()->showMessage(QStringLiteral("🆕 显示最近30天新增图书，共 %1 本").arg(rows.size()), 3000);
 }
 
 void MainWindow::onShowExpensiveBooks()
@@ -1258,9 +1367,9 @@ void MainWindow::onShowExpensiveBooks()
     double minPrice = QInputDialog::getDouble(this, QStringLiteral("💰 高价图书筛选"), 
                                             QStringLiteral("请输入最低价格:"), 50.0, 0.0, 10000.0, 2, &ok);
     if (ok) {
-        QVector<Book> expensiveBooks = library_.getExpensiveBooks(minPrice);
-        refreshTable(expensiveBooks);
-        statusBar()->showMessage(QStringLiteral("💰 显示价格 ≥ %1 元的图书，共 %2 本").arg(minPrice).arg(expensiveBooks.size()), 3000);
+        const QVector<int> rows = library_.rowsByPriceRange(minPrice, std::numeric_limits<double>::infinity());
+        refreshTableRows(rows);
+        statusBar()->showMessage(QStringLiteral("💰 显示价格 ≥ %1 元的图书，共 %2 本").arg(minPrice).arg(rows.size()), 3000);
     }
 }
 
@@ -1270,9 +1379,9 @@ void MainWindow::onShowCheapBooks()
     double maxPrice = QInputDialog::getDouble(this, QStringLiteral("💸 低价图书筛选"), 
                                             QStringLiteral("请输入最高价格:"), 30.0, 0.0, 10000.0, 2, &ok);
     if (ok) {
-        QVector<Book> cheapBooks = library_.getCheapBooks(maxPrice);
-        refreshTable(cheapBooks);
-        statusBar()->showMessage(QStringLiteral("💸 显示价格 ≤ %1 元的图书，共 %2 本").arg(maxPrice).arg(cheapBooks.size()), 3000);
+        const QVector<int> rows = library_.rowsByPriceRange(-std::numeric_limits<double>::infinity(), maxPrice);
+        refreshTableRows(rows);
+        statusBar()->showMessage(QStringLiteral("💸 显示价格 ≤ %1 元的图书，共 %2 本").arg(maxPrice).arg(rows.size()), 3000);
     }
 }
 
@@ -1308,45 +1417,52 @@ void MainWindow::onShowStatistics()
 void MainWindow::onSortByName()
 {
     library_.sortByName();
-    refreshTable(library_.getAll());
-    statusBar()->showMessage(QStringLiteral("🔤 已按名称排序"), 3000);
+    refreshTable();
+    statusBar()->showMessage(QStringLiteral("🔤 已按名称（拼音）排序"), 3000);
 }
 
 void MainWindow::onSortByCategory()
 {
     library_.sortByCategory();
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("📚 已按分类排序"), 3000);
 }
 
 void MainWindow::onSortByLocation()
 {
     library_.sortByLocation();
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("📍 已按位置排序"), 3000);
 }
 
 void MainWindow::onSortByPrice()
 {
     library_.sortByPrice();
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("💵 已按价格排序（高到低）"), 3000);
 }
 
 void MainWindow::onSortByDate()
 {
     library_.sortByDate();
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("📅 已按入库日期排序（新到旧）"), 3000);
 }
 
 void MainWindow::onSortByBorrowCount()
 {
     library_.sortByBorrowCount();
-    refreshTable(library_.getAll());
+    refreshTable();
     statusBar()->showMessage(QStringLiteral("📈 已按借阅次数排序（高到低）"), 3000);
 }
 
+void MainWindow::onSortByCategoryAndName()
+{
+    library_.setSortOrder({ SortKey{ QueryPredicate::CategoryField }, SortKey{ QueryPredicate::NameField } });
+    refreshTable();
+    statusBar()->showMessage(QStringLiteral("🗂️ 已按分类、再按名称排序"), 3000);
+}
+
 void MainWindow::onAdvancedSearch()
 {
     bool ok;
@@ -1354,24 +1470,92 @@ void MainWindow::onAdvancedSearch()
                                            QStringLiteral("请输入搜索关键词（支持书名、分类、位置、索引号）:"), 
                                            QLineEdit::Normal, "", &ok);
     if (ok && !keyword.trimmed().isEmpty()) {
-        QVector<Book> searchResults = library_.searchBooks(keyword.trimmed());
-        refreshTable(searchResults);
-        statusBar()->showMessage(QStringLiteral("🔍 搜索到 %1 本相关图书").arg(searchResults.size()), 3000);
+        explicitSearch_ = queryExecutor_->submit(keyword.trimmed(), QueryExecutor::SubstringMode);
     }
 }
 
+void MainWindow::onCombinedFilter()
+{
+    // 各条件组合成一个查询交给 LibraryManager 一次求值（见 queryplanner.h），不逐个筛选再求交
+    QDialog dlg(this);
+    dlg.setWindowTitle(QStringLiteral("🧩 组合筛选"));
+    auto *form = new QFormLayout(&dlg);
+    auto *keywordEdit = new QLineEdit(&dlg);
+    keywordEdit->setPlaceholderText(QStringLiteral("书名、分类、位置、索引号，可不填"));
+    auto *categoryBox = new QComboBox(&dlg);
+    categoryBox->addItem(QStringLiteral("全部"));
+    categoryBox->addItems(library_.categories());
+    auto *locationBox = new QComboBox(&dlg);
+    locationBox->addItem(QStringLiteral("全部"));
+    locationBox->addItems(library_.locations());
+    auto *minPriceBox = new QDoubleSpinBox(&dlg);
+    minPriceBox->setRange(0.0, 10000.0);
+    minPriceBox->setDecimals(2);
+    auto *maxPriceBox = new QDoubleSpinBox(&dlg);
+    maxPriceBox->setRange(0.0, 10000.0);
+    maxPriceBox->setDecimals(2);
+    maxPriceBox->setValue(maxPriceBox->maximum());
+    auto *recentDaysBox = new QSpinBox(&dlg);
+    recentDaysBox->setRange(0, 3650);
+    recentDaysBox->setSpecialValueText(QStringLiteral("不限"));
+    recentDaysBox->setSuffix(QStringLiteral(" 天内"));
+    auto *availableCheck = new QCheckBox(QStringLiteral("只看可借图书"), &dlg);
+    auto *sortBox = new QComboBox(&dlg);
+    sortBox->addItems({ QStringLiteral("目录顺序"), QStringLiteral("名称"), QStringLiteral("价格（高到低）"),
+                        QStringLiteral("入库日期（新到旧）"), QStringLiteral("借阅次数（高到低）") });
+    auto *buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, &dlg);
+    connect(buttons, &QDialogButtonBox::accepted, &dlg, &QDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, &dlg, &QDialog::reject);
+    form->addRow(QStringLiteral("关键词:"), keywordEdit);
+    form->addRow(QStringLiteral("分类:"), categoryBox);
+    form->addRow(QStringLiteral("位置:"), locationBox);
+    form->addRow(QStringLiteral("最低价格:"), minPriceBox);
+    form->addRow(QStringLiteral("最高价格:"), maxPriceBox);
+    form->addRow(QStringLiteral("入库时间:"), recentDaysBox);
+    form->addRow(QString(), availableCheck);
+    form->addRow(QStringLiteral("排序:"), sortBox);
+    form->addRow(buttons);
+    if (dlg.exec() != QDialog::Accepted) return;
+
+    QueryPredicate where;
+    const QString keyword = keywordEdit->text().trimmed();
+    if (!keyword.isEmpty()) where = where && QueryPredicate::contains(QueryPredicate::AnyTextField, keyword);
+    if (categoryBox->currentIndex() > 0) {
+        where = where && QueryPredicate::equals(QueryPredicate::CategoryField, categoryBox->currentText());
+    }
+    if (locationBox->currentIndex() > 0) {
+        where = where && QueryPredicate::equals(QueryPredicate::LocationField, locationBox->currentText());
+    }
+    if (minPriceBox->value() > minPriceBox->minimum() || maxPriceBox->value() < maxPriceBox->maximum()) {
+        const double maxPrice = maxPriceBox->value() < maxPriceBox->maximum() ? maxPriceBox->value() : std::numeric_limits<double>::infinity();
+        where = where && QueryPredicate::between(QueryPredicate::PriceField, minPriceBox->value(), maxPrice);
+    }
+    if (recentDaysBox->value() > 0) {
+        where = where && QueryPredicate::between(QueryPredicate::InDateField, QDate::currentDate().addDays(-recentDaysBox->value()), QDate());
+    }
+    if (availableCheck->isChecked()) where = where && QueryPredicate::available();
+
+    CatalogQuery query(where);
+    switch (sortBox->currentIndex()) {
+    case 1: query.orderBy(QueryPredicate::NameField); break;
+    case 2: query.orderBy(QueryPredicate::PriceField, Qt::DescendingOrder); break;
+    case 3: query.orderBy(QueryPredicate::InDateField, Qt::DescendingOrder); break;
+    case 4: query.orderBy(QueryPredicate::BorrowCountField, Qt::DescendingOrder); break;
+    default: break;
+    }
+    const QVector<int> rows = library_.queryRows(query);
+    refreshTableRows(rows);
+    statusBar()->showMessage(QStringLiteral("🧩 组合筛选，共 %1 本").arg(rows.size()), 3000);
+}
+
 void MainWindow::onExportData()
 {
     const QString path = QFileDialog::getSaveFileName(this, QStringLiteral("📤 导出数据"), 
                                                      QStringLiteral("library_export.json"), 
                                                      QStringLiteral("JSON 文件 (*.json);;所有文件 (*.*)"));
     if (!path.isEmpty()) {
-        QString err;
-        if (library_.saveToFile(path, &err)) {
-            statusBar()->showMessage(QStringLiteral("✅ 数据导出成功: %1").arg(QFileInfo(path).fileName()), 3000);
-        } else {
-            QMessageBox::warning(this, QStringLiteral("❌ 导出失败"), err);
-        }
+        saveCatalogAsync(path, false, QStringLiteral("✅ 数据导出成功: %1").arg(QFileInfo(path).fileName()),
+                         QStringLiteral("❌ 导出失败"));
     }
 }
 
@@ -1381,8 +1565,8 @@ void MainWindow::onImportData()
                                                      QStringLiteral("JSON 文件 (*.json);;所有文件 (*.*)"));
     if (!path.isEmpty()) {
         QString err;
-        if (library_.loadFromFile(path, &err)) {
-            refreshTable(library_.getAll());
+        if (loadCatalog(path, &err)) {
+            refreshTable();
             statusBar()->showMessage(QStringLiteral("✅ 数据导入成功: %1").arg(QFileInfo(path).fileName()), 3000);
         } else {
             QMessageBox::warning(this, QStringLiteral("❌ 导入失败"), err);
@@ -1395,12 +1579,8 @@ void MainWindow::onBackupData()
     QString timestamp = QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss");
     QString backupPath = QStringLiteral("backup_%1.json").arg(timestamp);
     
-    QString err;
-    if (library_.saveToFile(backupPath, &err)) {
-        statusBar()->showMessage(QStringLiteral("💾 数据备份成功: %1").arg(backupPath), 3000);
-    } else {
-        QMessageBox::warning(this, QStringLiteral("❌ 备份失败"), err);
-    }
+    saveCatalogAsync(backupPath, false, QStringLiteral("💾 数据备份成功: %1").arg(backupPath),
+                     QStringLiteral("❌ 备份失败"));
 }
 
 void MainWindow::onRestoreData()
@@ -1413,8 +1593,8 @@ void MainWindow::onRestoreData()
                                           QMessageBox::Yes | QMessageBox::No);
         if (reply == QMessageBox::Yes) {
             QString err;
-            if (library_.loadFromFile(path, &err)) {
-                refreshTable(library_.getAll());
+            if (loadCatalog(path, &err)) {
+                refreshTable();
                 statusBar()->showMessage(QStringLiteral("✅ 数据恢复成功: %1").arg(QFileInfo(path).fileName()), 3000);
             } else {
                 QMessageBox::warning(this, QStringLiteral("❌ 恢复失败"), err);
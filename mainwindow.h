@@ -2,15 +2,18 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
-#include <QStandardItemModel>
 #include <QTableView>
+#include <QHash>
 #include "librarymanager.h"
+#include "booktablemodel.h"
 #include "bookdialog.h"
+#include "queryexecutor.h"
 
 class QScrollArea;
 class QDockWidget;
 class QLineEdit;
 class QPushButton;
+class QStringListModel;
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -31,11 +34,13 @@ public:
     void setCurrentUser(const QString &username);
     bool isAdminMode() const;
     QString getCurrentUser() const;
+    // "热门图书"显示的名次数，默认 10
+    void setTopBorrowedLimit(int limit);
 
 private:
     Ui::MainWindow *ui;
     LibraryManager library_;
-    QStandardItemModel *model_ = nullptr;
+    BookTableModel *model_ = nullptr;
     QTableView *tableView_ = nullptr;
     
     // 用户模式相关
@@ -45,6 +50,11 @@ private:
     // 搜索框相关
     QLineEdit *searchEdit_;
     QPushButton *searchButton_;
+    QueryExecutor *queryExecutor_ = nullptr;   // 搜索在工作线程执行（见 queryexecutor.h）
+    quint64 explicitSearch_ = 0;   // 回车/按钮/高级搜索发起的查询代数，结果为空时需要提示
+    QStringListModel *suggestionModel_ = nullptr;   // 自动补全列表
+    
+    int topBorrowedLimit_ = 10;
     
     // 主题相关
     bool isDarkMode_;
@@ -58,9 +68,21 @@ private:
     QMenu *dataMenu_;
     QMenu *systemMenu_;
 
+    // 后台保存的编号（见 LibraryManager::saveToFileAsync）-> (成功提示, 失败标题)
+    struct PendingSave {
+        QString successMessage;
+        QString failureTitle;
+    };
+    QHash<quint64, PendingSave> pendingSaves_;
+
 private:
     void setupTable();
-    void refreshTable(const QVector<Book> &books);
+    void refreshTable();
+    void refreshTable(const BookView &view);
+    void refreshTableRows(const QVector<int> &rows);
+    void updateTableStatus();
+    bool loadCatalog(const QString &path, QString *errorMessage);
+    void saveCatalogAsync(const QString &path, bool snapshot, const QString &successMessage, const QString &failureTitle);
     void setupActions();
     void setupStyles();
     void updateUIForUserMode();
@@ -71,6 +93,7 @@ private:
     void toggleTheme();
     void applyTheme(bool isDark);
     QString getThemeStyles(bool isDark);
+    void openLocalStore();
     void initializeSampleBooks();
     void setupMenuBar();
 
@@ -81,6 +104,8 @@ private slots:
     void onBorrow();
     void onReturn();
     void onSearch();
+    void onSearchTextEdited(const QString &text);
+    void onSearchResults(quint64 generation, const QString &keyword, const QVector<int> &rows);
     void onShowDue();
     void onSortByBorrow();
     void onOpen();
@@ -104,10 +129,13 @@ private slots:
     void onSortByPrice();
     void onSortByDate();
     void onSortByBorrowCount();
+    void onSortByCategoryAndName();
     void onAdvancedSearch();
+    void onCombinedFilter();
     void onExportData();
     void onImportData();
     void onBackupData();
     void onRestoreData();
+    void onSaveFinished(quint64 saveId, const QString &filePath, bool ok, const QString &errorMessage);
 };
 #endif // MAINWINDOW_H
@@ -0,0 +1,327 @@
+#include "ngramindex.h"
+
+#include "catalogcolumns.h"
+#include "chinesetext.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+struct Match {
+    int field;
+    int kind;     // 0 完全相同，1 前缀，2 中间子串
+    int position;
+    int length;
+    int row;
+
+    bool operator<(const Match &other) const
+    {
+        if (field != other.field) return field < other.field;
+        if (kind != other.kind) return kind < other.kind;
+        if (position != other.position) return position < other.position;
+        if (length != other.length) return length < other.length;
+        return row < other.row;
+    }
+};
+
+// 分类/馆藏地址取值很少，按字典编码各归一化一次，各行共享同一份字符串
+QVector<QString> normalizedColumn(const QVector<int> &codes, const StringDictionary &dictionary)
+{
+    QVector<QString> normalized(dictionary.size());
+    for (int code = 0; code < dictionary.size(); ++code) {
+        normalized[code] = ChineseText::normalize(dictionary.valueOf(code));
+    }
+    QVector<QString> column;
+    column.reserve(codes.size());
+    for (int code : codes) column.append(normalized[code]);
+    return column;
+}
+
+} // namespace
+
+void NGramIndex::clear()
+{
+    postings_.clear();
+    for (QVector<QString> &texts : texts_) texts.clear();
+    slotOfRow_.clear();
+    rowOfSlot_.clear();
+}
+
+void NGramIndex::rebuild(const CatalogColumns &columns)
+{
+    clear();
+    const int n = columns.size();
+    texts_[NameField].reserve(n);
+    texts_[IndexIdField].reserve(n);
+    for (int row = 0; row < n; ++row) {
+        texts_[NameField].append(ChineseText::normalize(columns.names()[row]));
+        texts_[IndexIdField].append(ChineseText::normalize(columns.indexIds()[row]));
+    }
+    texts_[CategoryField] = normalizedColumn(columns.categoryCodes(), columns.categoryDictionary());
+    texts_[LocationField] = normalizedColumn(columns.locationCodes(), columns.locationDictionary());
+    // 重建时槽位号与行号相同
+    slotOfRow_.resize(n);
+    std::iota(slotOfRow_.begin(), slotOfRow_.end(), 0);
+    rowOfSlot_ = slotOfRow_;
+    // 按槽位顺序追加，每个倒排表天然有序
+    for (int slot = 0; slot < n; ++slot) addSlot(slot);
+}
+
+void NGramIndex::insert(int row, const CatalogColumns &columns)
+{
+    Q_ASSERT(row == slotOfRow_.size());
+    const int slot = texts_[NameField].size();
+    texts_[NameField].append(ChineseText::normalize(columns.name(row)));
+    texts_[IndexIdField].append(ChineseText::normalize(columns.indexId(row)));
+    texts_[CategoryField].append(ChineseText::normalize(columns.category(row)));
+    texts_[LocationField].append(ChineseText::normalize(columns.location(row)));
+    slotOfRow_.append(slot);
+    rowOfSlot_.append(row);
+    addSlot(slot);
+}
+
+void NGramIndex::update(int row, const CatalogColumns &columns)
+{
+    const int slot = slotOfRow_.at(row);
+    removeGrams(slot);
+    texts_[NameField][slot] = ChineseText::normalize(columns.name(row));
+    texts_[IndexIdField][slot] = ChineseText::normalize(columns.indexId(row));
+    texts_[CategoryField][slot] = ChineseText::normalize(columns.category(row));
+    texts_[LocationField][slot] = ChineseText::normalize(columns.location(row));
+    addSlot(slot);
+}
+
+void NGramIndex::removeRow(int row)
+{
+    const int slot = slotOfRow_.at(row);
+    removeGrams(slot);
+    // 其余倒排表存的槽位号不变，检索快照与这里共享的倒排表和文本都不会被复制
+    slotOfRow_.removeAt(row);
+    rowOfSlot_[slot] = -1;
+    for (int s = slot + 1; s < rowOfSlot_.size(); ++s) {
+        if (rowOfSlot_[s] >= 0) --rowOfSlot_[s];
+    }
+}
+
+QVector<int> NGramIndex::search(const QString &keyword, int limit) const
+{
+    const QString normalized = ChineseText::normalize(keyword);
+    QVector<int> rows;
+    if (normalized.isEmpty()) {
+        const int n = slotOfRow_.size();
+        rows.resize(limit < 0 ? n : qMin(limit, n));
+        std::iota(rows.begin(), rows.end(), 0);
+        return rows;
+    }
+
+    QVector<Match> matches;
+    for (int slot : candidates(normalized)) {
+        for (int field = 0; field < FieldCount; ++field) {
+            const QString &text = texts_[field].at(slot);
+            const int position = text.indexOf(normalized);
+            if (position < 0) continue;
+            const int kind = position > 0 ? 2 : (text.size() == normalized.size() ? 0 : 1);
+            matches.append(Match{ field, kind, position, int(text.size()), rowOfSlot_.at(slot) });
+            break;
+        }
+    }
+    if (limit >= 0 && limit < matches.size()) {
+        std::partial_sort(matches.begin(), matches.begin() + limit, matches.end());
+        matches.resize(limit);
+    } else {
+        std::sort(matches.begin(), matches.end());
+    }
+    rows.reserve(matches.size());
+    for (const Match &m : matches) rows.append(m.row);
+    return rows;
+}
+
+int NGramIndex::findExact(Field field, const QString &text) const
+{
+    const QString normalized = ChineseText::normalize(text);
+    if (normalized.isEmpty()) {
+        for (int row = 0; row < slotOfRow_.size(); ++row) {
+            if (this->text(field, row).isEmpty()) return row;
+        }
+        return -1;
+    }
+    // 槽位升序即行号升序，第一个命中的就是最小行号
+    for (int slot : candidates(normalized)) {
+        if (texts_[field].at(slot) == normalized) return rowOfSlot_.at(slot);
+    }
+    return -1;
+}
+
+QVector<int> NGramIndex::rowsContaining(const QString &keyword) const
+{
+    const QString normalized = ChineseText::normalize(keyword);
+    QVector<int> rows;
+    if (normalized.isEmpty()) {
+        rows.resize(slotOfRow_.size());
+        std::iota(rows.begin(), rows.end(), 0);
+        return rows;
+    }
+    for (int slot : candidates(normalized)) {
+        for (const QVector<QString> &texts : texts_) {
+            if (texts.at(slot).contains(normalized)) {
+                rows.append(rowOfSlot_.at(slot));
+                break;
+            }
+        }
+    }
+    return rows;
+}
+
+QVector<int> NGramIndex::rowsContaining(Field field, const QString &keyword) const
+{
+    const QString normalized = ChineseText::normalize(keyword);
+    const QVector<QString> &texts = texts_[field];
+    QVector<int> rows;
+    if (normalized.isEmpty()) {
+        rows.resize(slotOfRow_.size());
+        std::iota(rows.begin(), rows.end(), 0);
+        return rows;
+    }
+    for (int slot : candidates(normalized)) {
+        if (texts.at(slot).contains(normalized)) rows.append(rowOfSlot_.at(slot));
+    }
+    return rows;
+}
+
+QVector<int> NGramIndex::rowsEqualTo(Field field, const QString &text) const
+{
+    const QString normalized = ChineseText::normalize(text);
+    const QVector<QString> &texts = texts_[field];
+    QVector<int> rows;
+    if (normalized.isEmpty()) {
+        for (int row = 0; row < slotOfRow_.size(); ++row) {
+            if (this->text(field, row).isEmpty()) rows.append(row);
+        }
+        return rows;
+    }
+    for (int slot : candidates(normalized)) {
+        if (texts.at(slot) == normalized) rows.append(rowOfSlot_.at(slot));
+    }
+    return rows;
+}
+
+int NGramIndex::estimate(const QString &keyword) const
+{
+    const QString normalized = ChineseText::normalize(keyword);
+    int bound = slotOfRow_.size();
+    if (normalized.isEmpty()) return bound;
+    for (Gram g : queryGrams(normalized)) {
+        const auto it = postings_.constFind(g);
+        if (it == postings_.cend()) return 0;
+        bound = qMin(bound, int(it.value().size()));
+    }
+    return bound;
+}
+
+const QString &NGramIndex::normalizedText(Field field, int row) const
+{
+    return text(field, row);
+}
+
+const QString &NGramIndex::text(int field, int row) const
+{
+    return texts_[field].at(slotOfRow_.at(row));
+}
+
+NGramIndex::Gram NGramIndex::gram(const QChar *s, int length)
+{
+    // 高 32 位记录长度，区分单字与首字为 U+0000 的双字
+    Gram g = Gram(length) << 32 | s[0].unicode();
+    if (length == 2) g |= Gram(s[1].unicode()) << 16;
+    return g;
+}
+
+QVector<NGramIndex::Gram> NGramIndex::gramsOf(const QString *texts)
+{
+    QVector<Gram> grams;
+    for (int field = 0; field < FieldCount; ++field) {
+        const QChar *s = texts[field].constData();
+        const int n = texts[field].size();
+        for (int i = 0; i < n; ++i) {
+            grams.append(gram(s + i, 1));
+            if (i + 1 < n) grams.append(gram(s + i, 2));
+        }
+    }
+    // 同一行在一张倒排表中只出现一次
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+QVector<NGramIndex::Gram> NGramIndex::queryGrams(const QString &normalized)
+{
+    QVector<Gram> grams;
+    if (normalized.size() == 1) {
+        grams.append(gram(normalized.constData(), 1));
+        return grams;
+    }
+    for (int i = 0; i + 1 < normalized.size(); ++i) {
+        grams.append(gram(normalized.constData() + i, 2));
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+void NGramIndex::addSlot(int slot)
+{
+    // 文本用 at() 只读取出，不让与检索快照共享的文本列分离
+    QString texts[FieldCount];
+    for (int field = 0; field < FieldCount; ++field) texts[field] = texts_[field].at(slot);
+    for (Gram g : gramsOf(texts)) {
+        QVector<int> &list = postings_[g];
+        if (list.isEmpty() || list.last() < slot) {
+            list.append(slot);
+        } else {
+            list.insert(std::lower_bound(list.begin(), list.end(), slot), slot);
+        }
+    }
+}
+
+void NGramIndex::removeGrams(int slot)
+{
+    QString texts[FieldCount];
+    for (int field = 0; field < FieldCount; ++field) texts[field] = texts_[field].at(slot);
+    for (Gram g : gramsOf(texts)) {
+        auto it = postings_.find(g);
+        if (it == postings_.end()) continue;
+        QVector<int> &list = it.value();
+        const auto pos = std::lower_bound(list.begin(), list.end(), slot);
+        if (pos != list.end() && *pos == slot) list.erase(pos);
+        if (list.isEmpty()) postings_.erase(it);
+    }
+}
+
+QVector<int> NGramIndex::candidates(const QString &normalized) const
+{
+    QVector<const QVector<int> *> lists;
+    for (Gram g : queryGrams(normalized)) {
+        const auto it = postings_.constFind(g);
+        if (it == postings_.cend()) return QVector<int>();
+        lists.append(&it.value());
+    }
+    // 从最短的表开始求交，结果只会越来越小
+    std::sort(lists.begin(), lists.end(), [](const QVector<int> *a, const QVector<int> *b) {
+        return a->size() < b->size();
+    });
+    QVector<int> result = *lists.first();
+    for (int i = 1; i < lists.size() && !result.isEmpty(); ++i) {
+        const QVector<int> &list = *lists[i];
+        // 较短的一侧逐个在较长的表中二分，起点随之前移
+        auto from = list.cbegin();
+        int kept = 0;
+        for (int row : result) {
+            from = std::lower_bound(from, list.cend(), row);
+            if (from == list.cend()) break;
+            if (*from == row) result[kept++] = row;
+        }
+        result.resize(kept);
+    }
+    return result;
+}
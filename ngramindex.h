@@ -0,0 +1,79 @@
+#ifndef NGRAMINDEX_H
+#define NGRAMINDEX_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+class CatalogColumns;
+
+// 全文检索用的字符 n-gram 倒排索引：单字/双字 -> 升序行号列表
+//
+// 书名以中文为主，无法按词切分，因此把名称、索引号、分类、馆藏地址归一化后
+// （见 chinesetext.h：全角转半角、转小写、繁体转简体）逐个单字和相邻双字建立倒排表。子串查询取关键字中的全部双字（单字关键字取单字），
+// 从最短的倒排表开始求交集，只对交集中的少数候选核对原文，不再逐本转换、比较字符串。
+// 索引自己保存每行归一化后的文本，删除和编辑时据此撤销旧的 n-gram，无需调用方提供旧值。
+// 倒排表与文本按槽位号存放：图书追加时分配下一个槽位，删除后空出的槽位不再复用，
+// 槽位先后与行号先后一致，倒排表按槽位有序即按行号有序。删除图书只撤销该行自己的 n-gram、
+// 改写槽位与行号（与 LibraryManager 中的下标一致）的对照表，其余倒排表和文本都不动；
+// 空出的槽位在 rebuild 时回收。
+class NGramIndex {
+public:
+    // 排名时字段的优先次序
+    enum Field {
+        NameField,
+        IndexIdField,
+        CategoryField,
+        LocationField,
+        FieldCount
+    };
+
+    void clear();
+    void rebuild(const CatalogColumns &columns);
+
+    // row 必须等于当前行数：LibraryManager 只在末尾追加图书
+    void insert(int row, const CatalogColumns &columns);
+    // 按 columns 中该行的新内容重新索引
+    void update(int row, const CatalogColumns &columns);
+    // 撤销 row 的 n-gram；其后各行的行号减一只反映在对照表中
+    void removeRow(int row);
+
+    // 任一字段包含 keyword（归一化后比较）的行，按匹配质量排序：
+    // 先比字段（名称 > 索引号 > 分类 > 馆藏地址），再比完全相同 > 前缀 > 中间子串，
+    // 再比匹配位置、字段长度，最后按行号。空关键字返回全部行（按行号）。
+    // limit < 0 表示不限
+    QVector<int> search(const QString &keyword, int limit = -1) const;
+    // field 与 text 归一化后完全相同的最小行号，没有返回 -1
+    int findExact(Field field, const QString &text) const;
+
+    // 组合查询（见 queryplanner.h）用：结果按行号升序，不排名
+    // 任一字段 / 指定字段包含 keyword 的行；空关键字返回全部行
+    QVector<int> rowsContaining(const QString &keyword) const;
+    QVector<int> rowsContaining(Field field, const QString &keyword) const;
+    // field 与 text 归一化后完全相同的行
+    QVector<int> rowsEqualTo(Field field, const QString &text) const;
+    // 包含 keyword 的行数上界（最短的查询 n-gram 倒排表长度），O(关键字长度)
+    int estimate(const QString &keyword) const;
+    // 归一化后的字段文本，逐行核对条件时不必重新归一化
+    const QString &normalizedText(Field field, int row) const;
+
+private:
+    typedef quint64 Gram;
+    static Gram gram(const QChar *s, int length);
+    static QVector<Gram> gramsOf(const QString *texts);
+    static QVector<Gram> queryGrams(const QString &normalized);
+
+    void addSlot(int slot);
+    void removeGrams(int slot);
+    // 包含 normalized 全部查询 n-gram 的槽位，升序；可能含有 n-gram 不相邻的假阳性
+    QVector<int> candidates(const QString &normalized) const;
+    const QString &text(int field, int row) const;
+
+private:
+    QHash<Gram, QVector<int>> postings_;   // n-gram -> 升序槽位号
+    QVector<QString> texts_[FieldCount];   // 归一化后的字段文本，按槽位号；空出的槽位保留旧文本
+    QVector<int> slotOfRow_;               // 行号 -> 槽位号
+    QVector<int> rowOfSlot_;               // 槽位号 -> 行号，空出的槽位为 -1
+};
+
+#endif // NGRAMINDEX_H
@@ -0,0 +1,298 @@
+#include "pinyinindex.h"
+
+#include "catalogcolumns.h"
+#include "chinesetext.h"
+
+#include <QSet>
+
+#include <algorithm>
+
+namespace {
+
+bool keyLess(const QString &aKey, int aRow, const QString &bKey, int bRow)
+{
+    const int c = aKey.compare(bKey);
+    return c != 0 ? c < 0 : aRow < bRow;
+}
+
+// 把 rows 中尚未出现过的行追加到 out，达到 limit 时返回 false
+bool appendUnique(const QVector<int> &rows, int limit, QSet<int> *seen, QVector<int> *out)
+{
+    for (int row : rows) {
+        if (limit >= 0 && out->size() >= limit) return false;
+        if (seen->contains(row)) continue;
+        seen->insert(row);
+        out->append(row);
+    }
+    return limit < 0 || out->size() < limit;
+}
+
+} // namespace
+
+void PinyinIndex::clear()
+{
+    names_.clear();
+    pinyin_.clear();
+    initials_.clear();
+    pinyinKeys_.clear();
+    initialKeys_.clear();
+    nameTree_.clear();
+    pinyinTree_.clear();
+}
+
+void PinyinIndex::rebuild(const CatalogColumns &columns)
+{
+    names_.clear();
+    pinyin_.clear();
+    initials_.clear();
+    const int n = columns.size();
+    names_.reserve(n);
+    pinyin_.reserve(n);
+    initials_.reserve(n);
+    for (const QString &name : columns.names()) {
+        names_.append(ChineseText::normalize(name));
+        pinyin_.append(ChineseText::pinyin(name));
+        initials_.append(ChineseText::initials(name));
+    }
+    pinyinKeys_.rebuild(pinyin_);
+    initialKeys_.rebuild(initials_);
+    nameTree_.rebuild(names_);
+    pinyinTree_.rebuild(pinyin_);
+}
+
+void PinyinIndex::insert(int row, const CatalogColumns &columns)
+{
+    Q_ASSERT(row == names_.size());
+    const QString &name = columns.name(row);
+    names_.append(ChineseText::normalize(name));
+    pinyin_.append(ChineseText::pinyin(name));
+    initials_.append(ChineseText::initials(name));
+    indexRow(row);
+}
+
+void PinyinIndex::update(int row, const CatalogColumns &columns)
+{
+    unindexRow(row);
+    const QString &name = columns.name(row);
+    names_[row] = ChineseText::normalize(name);
+    pinyin_[row] = ChineseText::pinyin(name);
+    initials_[row] = ChineseText::initials(name);
+    indexRow(row);
+}
+
+void PinyinIndex::removeRow(int row)
+{
+    unindexRow(row);
+    names_.removeAt(row);
+    pinyin_.removeAt(row);
+    initials_.removeAt(row);
+    pinyinKeys_.removeRow(row);
+    initialKeys_.removeRow(row);
+    nameTree_.removeRow(row);
+    pinyinTree_.removeRow(row);
+}
+
+QVector<int> PinyinIndex::search(const QString &keyword, int limit) const
+{
+    QVector<int> result;
+    QSet<int> seen;
+    const QString name = ChineseText::normalize(keyword.trimmed());
+    const QString spelled = ChineseText::pinyin(keyword);
+    if (name.isEmpty() || limit == 0) return result;
+
+    auto prefixGroup = [&spelled](const SortedKeys &keys) {
+        QVector<KeyEntry> entries;
+        keys.appendPrefixMatches(spelled, &entries);
+        // 越短越接近关键字，完全相同的排在最前
+        std::sort(entries.begin(), entries.end(), [](const KeyEntry &a, const KeyEntry &b) {
+            return a.key.size() != b.key.size() ? a.key.size() < b.key.size() : a.row < b.row;
+        });
+        QVector<int> rows;
+        rows.reserve(entries.size());
+        for (const KeyEntry &e : entries) rows.append(e.row);
+        return rows;
+    };
+    auto fuzzyGroup = [](const BkTree &tree, const QString &key) {
+        QVector<QPair<int, int>> matches;
+        tree.appendMatches(key, tolerance(key), &matches);
+        std::sort(matches.begin(), matches.end());
+        QVector<int> rows;
+        rows.reserve(matches.size());
+        for (const auto &m : matches) rows.append(m.second);
+        return rows;
+    };
+
+    if (!spelled.isEmpty()) {
+        if (!appendUnique(prefixGroup(initialKeys_), limit, &seen, &result)) return result;
+        if (!appendUnique(prefixGroup(pinyinKeys_), limit, &seen, &result)) return result;
+    }
+    if (!appendUnique(fuzzyGroup(nameTree_, name), limit, &seen, &result)) return result;
+    if (!spelled.isEmpty()) appendUnique(fuzzyGroup(pinyinTree_, spelled), limit, &seen, &result);
+    return result;
+}
+
+int PinyinIndex::tolerance(const QString &keyword)
+{
+    if (keyword.size() <= 2) return 0;
+    if (keyword.size() <= 5) return 1;
+    return 2;
+}
+
+void PinyinIndex::indexRow(int row)
+{
+    pinyinKeys_.insert(pinyin_[row], row);
+    initialKeys_.insert(initials_[row], row);
+    nameTree_.insert(names_[row], row);
+    pinyinTree_.insert(pinyin_[row], row);
+}
+
+void PinyinIndex::unindexRow(int row)
+{
+    pinyinKeys_.remove(pinyin_[row], row);
+    initialKeys_.remove(initials_[row], row);
+    nameTree_.remove(names_[row], row);
+    pinyinTree_.remove(pinyin_[row], row);
+}
+
+void PinyinIndex::SortedKeys::clear()
+{
+    entries_.clear();
+}
+
+void PinyinIndex::SortedKeys::rebuild(const QVector<QString> &keys)
+{
+    entries_.clear();
+    entries_.reserve(keys.size());
+    for (int row = 0; row < keys.size(); ++row) {
+        if (!keys[row].isEmpty()) entries_.append(KeyEntry{ keys[row], row });
+    }
+    std::sort(entries_.begin(), entries_.end(), [](const KeyEntry &a, const KeyEntry &b) {
+        return keyLess(a.key, a.row, b.key, b.row);
+    });
+}
+
+void PinyinIndex::SortedKeys::insert(const QString &key, int row)
+{
+    if (key.isEmpty()) return;
+    const auto pos = std::lower_bound(entries_.begin(), entries_.end(), row, [&key](const KeyEntry &e, int r) {
+        return keyLess(e.key, e.row, key, r);
+    });
+    entries_.insert(pos, KeyEntry{ key, row });
+}
+
+void PinyinIndex::SortedKeys::remove(const QString &key, int row)
+{
+    if (key.isEmpty()) return;
+    const auto pos = std::lower_bound(entries_.begin(), entries_.end(), row, [&key](const KeyEntry &e, int r) {
+        return keyLess(e.key, e.row, key, r);
+    });
+    if (pos != entries_.end() && pos->row == row && pos->key == key) entries_.erase(pos);
+}
+
+void PinyinIndex::SortedKeys::removeRow(int row)
+{
+    for (KeyEntry &e : entries_) {
+        if (e.row > row) --e.row;
+    }
+}
+
+void PinyinIndex::SortedKeys::appendPrefixMatches(const QString &prefix, QVector<KeyEntry> *out) const
+{
+    auto it = std::lower_bound(entries_.cbegin(), entries_.cend(), prefix, [](const KeyEntry &e, const QString &p) {
+        return e.key.compare(p) < 0;
+    });
+    for (; it != entries_.cend() && it->key.startsWith(prefix); ++it) out->append(*it);
+}
+
+void PinyinIndex::BkTree::clear()
+{
+    nodes_.clear();
+    nodeOf_.clear();
+}
+
+void PinyinIndex::BkTree::rebuild(const QVector<QString> &keys)
+{
+    // 只在加载新目录时调用。重新加载同一份或相近的目录时书名大多不变：
+    // 先保留树的结构，只重新挂行号，避免重新计算编辑距离
+    for (Node &node : nodes_) node.rows.clear();
+    for (int row = 0; row < keys.size(); ++row) insert(keys[row], row);
+    const int unused = int(std::count_if(nodes_.cbegin(), nodes_.cend(), [](const Node &node) {
+        return node.rows.isEmpty();
+    }));
+    // 换了一份目录后大部分节点都已无用，整棵重建
+    if (unused * 2 > nodes_.size()) {
+        clear();
+        for (int row = 0; row < keys.size(); ++row) insert(keys[row], row);
+    }
+}
+
+void PinyinIndex::BkTree::insert(const QString &key, int row)
+{
+    if (key.isEmpty()) return;
+    const auto found = nodeOf_.constFind(key);
+    if (found != nodeOf_.cend()) {
+        QVector<int> &rows = nodes_[found.value()].rows;
+        rows.insert(std::lower_bound(rows.begin(), rows.end(), row), row);
+        return;
+    }
+    const int created = nodes_.size();
+    if (created > 0) {
+        int node = 0;
+        for (;;) {
+            const QString &nodeKey = nodes_[node].key;
+            const int d = ChineseText::editDistance(key, nodeKey, qMax(key.size(), nodeKey.size()));
+            int next = -1;
+            for (const auto &child : nodes_[node].children) {
+                if (child.first == d) {
+                    next = child.second;
+                    break;
+                }
+            }
+            if (next < 0) {
+                nodes_[node].children.append(qMakePair(d, created));
+                break;
+            }
+            node = next;
+        }
+    }
+    Node n;
+    n.key = key;
+    n.rows.append(row);
+    nodes_.append(n);
+    nodeOf_.insert(key, created);
+}
+
+void PinyinIndex::BkTree::remove(const QString &key, int row)
+{
+    const auto found = nodeOf_.constFind(key);
+    if (found == nodeOf_.cend()) return;
+    QVector<int> &rows = nodes_[found.value()].rows;
+    const auto pos = std::lower_bound(rows.begin(), rows.end(), row);
+    if (pos != rows.end() && *pos == row) rows.erase(pos);
+}
+
+void PinyinIndex::BkTree::removeRow(int row)
+{
+    for (Node &node : nodes_) {
+        for (auto p = std::upper_bound(node.rows.begin(), node.rows.end(), row); p != node.rows.end(); ++p) {
+            --*p;
+        }
+    }
+}
+
+void PinyinIndex::BkTree::appendMatches(const QString &key, int tolerance, QVector<QPair<int, int>> *out) const
+{
+    if (nodes_.isEmpty() || key.isEmpty() || tolerance <= 0) return;
+    QVector<int> pending{ 0 };
+    while (!pending.isEmpty()) {
+        const Node &node = nodes_[pending.takeLast()];
+        // 三角不等式：只有到本节点距离在 [d - tolerance, d + tolerance] 内的子树可能命中
+        const int d = ChineseText::editDistance(key, node.key, qMax(key.size(), node.key.size()));
+        if (d <= tolerance) {
+            for (int row : node.rows) out->append(qMakePair(d, row));
+        }
+        for (const auto &child : node.children) {
+            if (child.first >= d - tolerance && child.first <= d + tolerance) pending.append(child.second);
+        }
+    }
+}
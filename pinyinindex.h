@@ -0,0 +1,88 @@
+#ifndef PINYININDEX_H
+#define PINYININDEX_H
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+class CatalogColumns;
+
+// 书名的拼音与容错检索索引
+//
+// 每本书的书名预先算好归一化形式、全拼和拼音首字母（见 chinesetext.h）。
+// 全拼与首字母各有一个按字符串排序的数组，输入 "hlm"、"hongl" 这类前缀时二分定位，
+// 代价 O(log n + k)。另有两棵 BK 树分别收录归一化书名和全拼，按编辑距离找出打错字的书名，
+// 只访问距离可能落在容差内的分支。
+// 行号与 LibraryManager 中的下标一致，删除图书后由 removeRow 整体前移。
+class PinyinIndex {
+public:
+    void clear();
+    void rebuild(const CatalogColumns &columns);
+
+    // row 必须等于当前行数：LibraryManager 只在末尾追加图书
+    void insert(int row, const CatalogColumns &columns);
+    // 书名变化后按 columns 中的新书名重新索引
+    void update(int row, const CatalogColumns &columns);
+    void removeRow(int row);
+
+    // 依次为：首字母前缀、全拼前缀（同组内完全相同的在前，再按长度、行号），
+    // 然后是编辑距离在容差内的书名和全拼（按距离）；各组之间去重。limit < 0 表示不限
+    QVector<int> search(const QString &keyword, int limit = -1) const;
+    // 按关键字长度给出的编辑距离容差：过短的关键字不做容错
+    static int tolerance(const QString &keyword);
+
+private:
+    struct KeyEntry {
+        QString key;
+        int row;
+    };
+    // 按 (key, row) 升序的数组，支持前缀查询
+    class SortedKeys {
+    public:
+        void clear();
+        void rebuild(const QVector<QString> &keys);
+        void insert(const QString &key, int row);
+        void remove(const QString &key, int row);
+        void removeRow(int row);
+        void appendPrefixMatches(const QString &prefix, QVector<KeyEntry> *out) const;
+
+    private:
+        QVector<KeyEntry> entries_;
+    };
+    // BK 树：同一字符串的各行挂在同一节点；删除只摘掉行号，节点保留作路由
+    class BkTree {
+    public:
+        void clear();
+        // keys[row] 为第 row 行的字符串
+        void rebuild(const QVector<QString> &keys);
+        void insert(const QString &key, int row);
+        void remove(const QString &key, int row);
+        void removeRow(int row);
+        // (距离, 行号)
+        void appendMatches(const QString &key, int tolerance, QVector<QPair<int, int>> *out) const;
+
+    private:
+        struct Node {
+            QString key;
+            QVector<int> rows;
+            QVector<QPair<int, int>> children;   // (到本节点的距离, 子节点)
+        };
+        QVector<Node> nodes_;
+        QHash<QString, int> nodeOf_;
+    };
+
+    void indexRow(int row);
+    void unindexRow(int row);
+
+private:
+    QVector<QString> names_;      // 归一化书名
+    QVector<QString> pinyin_;
+    QVector<QString> initials_;
+    SortedKeys pinyinKeys_;
+    SortedKeys initialKeys_;
+    BkTree nameTree_;
+    BkTree pinyinTree_;
+};
+
+#endif // PINYININDEX_H
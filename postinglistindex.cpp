@@ -0,0 +1,77 @@
+#include "postinglistindex.h"
+
+#include <algorithm>
+
+void PostingListIndex::clear()
+{
+    lists_.clear();
+}
+
+void PostingListIndex::rebuild(const QVector<int> &codes, int dictionarySize)
+{
+    lists_.clear();
+    lists_.resize(dictionarySize);
+    // 按行号顺序追加，每个列表天然有序
+    for (int row = 0; row < codes.size(); ++row) {
+        lists_[codes[row]].append(row);
+    }
+}
+
+void PostingListIndex::insert(int code, int row)
+{
+    if (code >= lists_.size()) lists_.resize(code + 1);
+    QVector<int> &list = lists_[code];
+    if (list.isEmpty() || list.last() < row) {
+        list.append(row);
+    } else {
+        list.insert(std::lower_bound(list.begin(), list.end(), row), row);
+    }
+}
+
+void PostingListIndex::remove(int code, int row)
+{
+    if (code < 0 || code >= lists_.size()) return;
+    QVector<int> &list = lists_[code];
+    const auto pos = std::lower_bound(list.begin(), list.end(), row);
+    if (pos != list.end() && *pos == row) list.erase(pos);
+}
+
+void PostingListIndex::removeRow(int row)
+{
+    for (QVector<int> &list : lists_) {
+        for (auto p = std::upper_bound(list.begin(), list.end(), row); p != list.end(); ++p) {
+            --*p;
+        }
+    }
+}
+
+QVector<int> PostingListIndex::rows(int code) const
+{
+    return (code >= 0 && code < lists_.size()) ? lists_[code] : QVector<int>();
+}
+
+int PostingListIndex::count(int code) const
+{
+    return (code >= 0 && code < lists_.size()) ? int(lists_[code].size()) : 0;
+}
+
+QVector<int> PostingListIndex::rowsForCodes(const QVector<int> &codes) const
+{
+    QVector<int> result;
+    int matchedLists = 0;
+    for (int code : codes) {
+        if (count(code) == 0) continue;
+        result += lists_[code];
+        ++matchedLists;
+    }
+    // 每行只属于一个编码，多个列表拼接后排序即为有序并集
+    if (matchedLists > 1) std::sort(result.begin(), result.end());
+    return result;
+}
+
+int PostingListIndex::countForCodes(const QVector<int> &codes) const
+{
+    int total = 0;
+    for (int code : codes) total += count(code);
+    return total;
+}
@@ -0,0 +1,34 @@
+#ifndef POSTINGLISTINDEX_H
+#define POSTINGLISTINDEX_H
+
+#include <QVector>
+
+// 字典编码列的倒排索引：编码 -> 升序行号列表
+//
+// 用于分类、馆藏地址这类取值很少、重复很多的列，编码来自 CatalogColumns 的字符串字典。
+// 筛选先在字典的不同取值（通常几十个）上匹配出编码，再合并对应的行号，
+// 代价与结果大小成正比，不必逐本比较字符串。
+// 行号与 LibraryManager 中的下标一致，删除图书后由 removeRow 整体前移。
+class PostingListIndex {
+public:
+    void clear();
+    // 按整列重建，codes[row] 为第 row 行的编码
+    void rebuild(const QVector<int> &codes, int dictionarySize);
+
+    // row 不小于已有行号时直接追加，否则按序插入
+    void insert(int code, int row);
+    void remove(int code, int row);
+    // 删除 row 之后，把所有大于 row 的行号减一
+    void removeRow(int row);
+
+    QVector<int> rows(int code) const;
+    int count(int code) const;
+    // 若干编码的行号并集，升序
+    QVector<int> rowsForCodes(const QVector<int> &codes) const;
+    int countForCodes(const QVector<int> &codes) const;
+
+private:
+    QVector<QVector<int>> lists_;   // 编码 -> 升序行号
+};
+
+#endif // POSTINGLISTINDEX_H
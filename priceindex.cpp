@@ -0,0 +1,76 @@
+#include "priceindex.h"
+
+#include <algorithm>
+
+bool PriceIndex::lessThan(const Entry &a, const Entry &b)
+{
+    return a.price < b.price || (a.price == b.price && a.row < b.row);
+}
+
+void PriceIndex::clear()
+{
+    entries_.clear();
+}
+
+void PriceIndex::rebuild(const QVector<double> &prices)
+{
+    entries_.clear();
+    entries_.reserve(prices.size());
+    for (int i = 0; i < prices.size(); ++i) {
+        entries_.append(Entry{ prices[i], i });
+    }
+    std::sort(entries_.begin(), entries_.end(), lessThan);
+}
+
+void PriceIndex::insert(double price, int row)
+{
+    const Entry e{ price, row };
+    entries_.insert(std::lower_bound(entries_.begin(), entries_.end(), e, lessThan), e);
+}
+
+void PriceIndex::remove(double price, int row)
+{
+    const Entry e{ price, row };
+    const auto it = std::lower_bound(entries_.begin(), entries_.end(), e, lessThan);
+    if (it != entries_.end() && it->row == row && it->price == price) entries_.erase(it);
+}
+
+void PriceIndex::removeRow(int row)
+{
+    // 同价格内按行号排序，整体减一不改变相对顺序
+    for (Entry &e : entries_) {
+        if (e.row > row) --e.row;
+    }
+}
+
+QVector<PriceIndex::Entry>::const_iterator PriceIndex::lowerBound(double minPrice) const
+{
+    return std::lower_bound(entries_.cbegin(), entries_.cend(), minPrice,
+                            [](const Entry &e, double price) { return e.price < price; });
+}
+
+QVector<PriceIndex::Entry>::const_iterator PriceIndex::upperBound(double maxPrice) const
+{
+    return std::upper_bound(entries_.cbegin(), entries_.cend(), maxPrice,
+                            [](double price, const Entry &e) { return price < e.price; });
+}
+
+int PriceIndex::count(double minPrice, double maxPrice) const
+{
+    if (minPrice > maxPrice) return 0;
+    return int(upperBound(maxPrice) - lowerBound(minPrice));
+}
+
+QVector<int> PriceIndex::rows(double minPrice, double maxPrice, int offset, int limit) const
+{
+    QVector<int> result;
+    if (minPrice > maxPrice) return result;
+    auto first = lowerBound(minPrice);
+    const auto last = upperBound(maxPrice);
+    first += std::min<qsizetype>(qMax(offset, 0), last - first);
+    qsizetype n = last - first;
+    if (limit >= 0 && limit < n) n = limit;
+    result.reserve(n);
+    for (qsizetype i = 0; i < n; ++i) result.append(first[i].row);
+    return result;
+}
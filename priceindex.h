@@ -0,0 +1,41 @@
+#ifndef PRICEINDEX_H
+#define PRICEINDEX_H
+
+#include <QVector>
+
+// 价格有序索引：按 (价格, 行号) 升序排列的数组
+//
+// 区间查询用两次二分定位边界，代价 O(log n + k)，结果只返回行号，
+// 调用方按需分页读取图书，不复制整本 Book。
+// 价格只在新增/编辑/删除时变化，借还不触及本索引，因此直接在有序数组上插入删除。
+class PriceIndex {
+public:
+    void clear();
+    // 按价格列重建，row 即 prices 中的下标
+    void rebuild(const QVector<double> &prices);
+
+    void insert(double price, int row);
+    void remove(double price, int row);
+    // 删除 row 之后，把所有大于 row 的行号减一
+    void removeRow(int row);
+
+    // 价格在 [minPrice, maxPrice] 内的图书数
+    int count(double minPrice, double maxPrice) const;
+    // 价格在 [minPrice, maxPrice] 内、按价格升序的第 offset 条起最多 limit 条（limit < 0 表示不限）
+    QVector<int> rows(double minPrice, double maxPrice, int offset = 0, int limit = -1) const;
+
+private:
+    struct Entry {
+        double price;
+        int row;
+    };
+    static bool lessThan(const Entry &a, const Entry &b);
+
+    QVector<Entry>::const_iterator lowerBound(double minPrice) const;
+    QVector<Entry>::const_iterator upperBound(double maxPrice) const;
+
+private:
+    QVector<Entry> entries_;
+};
+
+#endif // PRICEINDEX_H
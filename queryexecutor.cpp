@@ -0,0 +1,83 @@
+#include "queryexecutor.h"
+
+#include "librarymanager.h"
+
+namespace {
+const int kDefaultDebounceMs = 150;
+const int kWorkerThreads = 2;   // 新查询开始时旧查询多半已作废，两个线程足够
+} // namespace
+
+QueryExecutor::QueryExecutor(const LibraryManager *library, QObject *parent)
+    : QObject(parent)
+    , library_(library)
+{
+    pool_.setMaxThreadCount(kWorkerThreads);
+    debounceTimer_.setSingleShot(true);
+    debounceTimer_.setInterval(kDefaultDebounceMs);
+    connect(&debounceTimer_, &QTimer::timeout, this, [this]() { start(generation_.load()); });
+}
+
+QueryExecutor::~QueryExecutor()
+{
+    cancel();
+    pool_.waitForDone();
+}
+
+void QueryExecutor::setDebounceInterval(int ms)
+{
+    debounceTimer_.setInterval(ms);
+}
+
+quint64 QueryExecutor::submitDebounced(const QString &keyword, Mode mode, int limit)
+{
+    const quint64 generation = ++generation_;
+    keyword_ = keyword;
+    mode_ = mode;
+    limit_ = limit;
+    debounceTimer_.start();
+    return generation;
+}
+
+quint64 QueryExecutor::submit(const QString &keyword, Mode mode, int limit)
+{
+    const quint64 generation = ++generation_;
+    keyword_ = keyword;
+    mode_ = mode;
+    limit_ = limit;
+    debounceTimer_.stop();
+    start(generation);
+    return generation;
+}
+
+void QueryExecutor::cancel()
+{
+    ++generation_;
+    debounceTimer_.stop();
+    pool_.clear();
+}
+
+void QueryExecutor::start(quint64 generation)
+{
+    const SearchSnapshot snapshot = library_->searchSnapshot();
+    const QString keyword = keyword_;
+    const Mode mode = mode_;
+    const int limit = limit_;
+    pool_.start([this, generation, snapshot, keyword, mode, limit]() {
+        const SearchSnapshot::CancelCheck cancelled = [this, generation]() {
+            return generation_.load() != generation;
+        };
+        if (cancelled()) return;
+        const QVector<int> rows = mode == FuzzyMode ? snapshot.fuzzySearch(keyword, limit, cancelled)
+                                                    : snapshot.search(keyword, limit);
+        if (cancelled()) return;
+        const quint64 version = snapshot.version();
+        QMetaObject::invokeMethod(this, [this, generation, keyword, rows, version]() {
+            if (generation_.load() != generation) return;
+            if (version != library_->catalogVersion()) {
+                start(generation);
+                return;
+            }
+            emit resultsReady(generation, keyword, rows);
+        }, Qt::QueuedConnection);
+    });
+}
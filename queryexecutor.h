@@ -0,0 +1,56 @@
+#ifndef QUERYEXECUTOR_H
+#define QUERYEXECUTOR_H
+
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVector>
+
+#include <atomic>
+
+class LibraryManager;
+
+// 在工作线程上执行检索，界面线程只负责提交和显示结果
+//
+// 提交时在界面线程取一份检索索引的只读副本（见 searchsnapshot.h），检索在线程池中进行，
+// 完成后通过 resultsReady 信号回到界面线程。每次提交都使代数加一，
+// 旧代数的查询在开始前、各阶段之间和交付前都会检查并放弃，因此连续输入时只有最后一次会显示。
+// 交付时若目录版本已变（期间有增删或重新加载），行号不再可靠，自动用新副本重新检索。
+class QueryExecutor : public QObject {
+    Q_OBJECT
+public:
+    enum Mode {
+        SubstringMode,   // LibraryManager::searchRows
+        FuzzyMode        // LibraryManager::fuzzySearchRows
+    };
+
+    explicit QueryExecutor(const LibraryManager *library, QObject *parent = nullptr);
+    ~QueryExecutor() override;
+
+    void setDebounceInterval(int ms);
+    // 输入停顿 debounce 间隔后再执行；返回本次查询的代数
+    quint64 submitDebounced(const QString &keyword, Mode mode, int limit = -1);
+    // 立即执行；返回本次查询的代数
+    quint64 submit(const QString &keyword, Mode mode, int limit = -1);
+    // 作废所有未完成的查询
+    void cancel();
+
+signals:
+    void resultsReady(quint64 generation, const QString &keyword, const QVector<int> &rows);
+
+private:
+    void start(quint64 generation);
+
+private:
+    const LibraryManager *library_ = nullptr;
+    QThreadPool pool_;
+    QTimer debounceTimer_;
+    std::atomic<quint64> generation_{0};
+    // 等待 debounce 或重新检索的查询
+    QString keyword_;
+    Mode mode_ = FuzzyMode;
+    int limit_ = -1;
+};
+
+#endif // QUERYEXECUTOR_H
@@ -0,0 +1,416 @@
+#include "queryplanner.h"
+
+#include "bookfields.h"
+#include "catalogcolumns.h"
+#include "chinesetext.h"
+#include "columnkernels.h"
+#include "duedateindex.h"
+#include "ngramindex.h"
+#include "postinglistindex.h"
+#include "priceindex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace {
+const int kIndexDivisor = 8;   // 估计命中数不超过总行数的 1/8 时由索引产生候选行，否则整列扫描
+
+bool isTextField(QueryPredicate::Field field)
+{
+    return field == QueryPredicate::NameField || field == QueryPredicate::IndexIdField
+        || field == QueryPredicate::CategoryField || field == QueryPredicate::LocationField
+        || field == QueryPredicate::AnyTextField;
+}
+
+NGramIndex::Field textField(QueryPredicate::Field field)
+{
+    switch (field) {
+    case QueryPredicate::IndexIdField: return NGramIndex::IndexIdField;
+    case QueryPredicate::CategoryField: return NGramIndex::CategoryField;
+    case QueryPredicate::LocationField: return NGramIndex::LocationField;
+    default: return NGramIndex::NameField;
+    }
+}
+
+// 整数列上的闭区间：向内取整并限制在 qint32 范围内
+qint32 lowerBound(double lo, qint32 floor)
+{
+    if (!(lo > floor)) return floor;
+    if (lo >= std::numeric_limits<qint32>::max()) return std::numeric_limits<qint32>::max();
+    return qint32(std::ceil(lo));
+}
+
+qint32 upperBound(double hi)
+{
+    if (!(hi < std::numeric_limits<qint32>::max())) return std::numeric_limits<qint32>::max();
+    if (hi <= std::numeric_limits<qint32>::min()) return std::numeric_limits<qint32>::min();
+    return qint32(std::floor(hi));
+}
+
+// 没有日期（kNoDay）的图书不落在任何日期区间内
+qint32 dayFloor()
+{
+    return CatalogColumns::kNoDay + 1;
+}
+
+void setRows(const QVector<int> &rows, quint64 *bits)
+{
+    for (int row : rows) bits[row >> 6] |= quint64(1) << (row & 63);
+}
+
+// 数值/日期字段上的区间用向量化内核扫描整列；整数列的边界向内取整
+template <typename F>
+void selectRange(const CatalogColumns &columns, double lo, double hi, quint64 *bits)
+{
+    const auto key = F::key(columns);
+    const int n = columns.size();
+    if constexpr (std::is_same<typename F::Value, double>::value) {
+        ColumnKernels::selectInRange(key.values, n, lo, hi, bits);
+    } else {
+        const qint32 floor = F::dated ? dayFloor() : std::numeric_limits<qint32>::min();
+        ColumnKernels::selectInRange(key.values, n, lowerBound(lo, floor), upperBound(hi), bits);
+    }
+}
+
+// 前 end 条按 less 排好，其余的顺序不定
+template <typename Less>
+void sortRows(QVector<int> &rows, int end, Less less)
+{
+    if (end < rows.size()) {
+        std::partial_sort(rows.begin(), rows.begin() + end, rows.end(), less);
+    } else {
+        std::sort(rows.begin(), rows.end(), less);
+    }
+}
+
+} // namespace
+
+QueryPlanner::QueryPlanner(const CatalogColumns &columns, const QHash<QString, int> &ids,
+                           const PostingListIndex &categories, const PostingListIndex &locations,
+                           const PriceIndex &prices, const DueDateIndex &dueDates, const NGramIndex &text)
+    : columns_(columns)
+    , ids_(ids)
+    , categories_(categories)
+    , locations_(locations)
+    , prices_(prices)
+    , dueDates_(dueDates)
+    , text_(text)
+{
+}
+
+QVector<int> QueryPlanner::execute(const CatalogQuery &query) const
+{
+    Plan plan;
+    const int root = compile(query.predicate(), plan);
+    QVector<int> result = rows(plan, root);
+    order(result, query);
+    return result;
+}
+
+QVector<quint64> QueryPlanner::availableSelection(const CatalogColumns &columns)
+{
+    // 可借 = 可借位 && 数量 > 0；数量列先比较出位图，再与可借位图按字求与
+    const int n = columns.size();
+    QVector<quint64> bits(ColumnKernels::wordCount(n));
+    ColumnKernels::selectInRange(columns.quantities().constData(), n, 1, std::numeric_limits<qint32>::max(), bits.data());
+    ColumnKernels::andBits(bits.constData(), columns.availableBits().constData(), bits.data(), n);
+    return bits;
+}
+
+QVector<quint64> QueryPlanner::borrowedSelection(const CatalogColumns &columns)
+{
+    // 已借出 = !可借位 || 数量 == 0
+    const int n = columns.size();
+    QVector<quint64> bits(ColumnKernels::wordCount(n));
+    QVector<quint64> unavailable(bits.size());
+    ColumnKernels::selectInRange(columns.quantities().constData(), n, 0, 0, bits.data());
+    ColumnKernels::notBits(columns.availableBits().constData(), unavailable.data(), n);
+    ColumnKernels::orBits(bits.constData(), unavailable.constData(), bits.data(), n);
+    return bits;
+}
+
+int QueryPlanner::compile(const QueryPredicate &predicate, Plan &plan) const
+{
+    Step step;
+    step.kind = predicate.kind();
+    step.field = predicate.field();
+    step.lower = predicate.lower();
+    step.upper = predicate.upper();
+    for (const QueryPredicate &child : predicate.children()) step.children.append(compile(child, plan));
+
+    const int n = columns_.size();
+    switch (step.kind) {
+    case QueryPredicate::Equals:
+    case QueryPredicate::Contains: {
+        const bool equals = step.kind == QueryPredicate::Equals;
+        if (!isTextField(step.field) || (equals && step.field == QueryPredicate::AnyTextField)) {
+            step.supported = false;
+            step.cost = 0;
+            break;
+        }
+        if (step.field == QueryPredicate::CategoryField || step.field == QueryPredicate::LocationField) {
+            const bool category = step.field == QueryPredicate::CategoryField;
+            const StringDictionary &dictionary = category ? columns_.categoryDictionary() : columns_.locationDictionary();
+            if (equals) {
+                const int code = dictionary.codeOf(predicate.text());
+                if (code >= 0) step.codes.append(code);
+            } else {
+                step.codes = dictionary.codesContaining(predicate.text());
+            }
+            step.codeMatches.fill(false, dictionary.size());
+            for (int code : step.codes) step.codeMatches[code] = true;
+            step.cost = (category ? categories_ : locations_).countForCodes(step.codes);
+        } else if (equals && step.field == QueryPredicate::IndexIdField) {
+            step.text = predicate.text();
+            step.cost = ids_.contains(step.text) ? 1 : 0;
+        } else {
+            step.text = ChineseText::normalize(predicate.text());
+            step.cost = text_.estimate(step.text);
+        }
+        break;
+    }
+    case QueryPredicate::Between:
+        if (step.field == QueryPredicate::PriceField) {
+            step.cost = prices_.count(step.lower, step.upper);
+        } else if (step.field == QueryPredicate::ReturnDateField) {
+            step.cost = dueDates_.loanCount();   // 只有借出中的图书有归还日期
+        } else if (isTextField(step.field)) {
+            step.supported = false;
+            step.cost = 0;
+        }
+        break;
+    case QueryPredicate::And:
+        // 取可由索引驱动的条件中估计最小的一个
+        for (int child : step.children) {
+            const int cost = plan[child].cost;
+            if (cost >= 0 && (step.cost < 0 || cost < step.cost)) step.cost = cost;
+        }
+        break;
+    case QueryPredicate::Or:
+        step.cost = 0;
+        for (int child : step.children) {
+            if (plan[child].cost < 0) {
+                step.cost = -1;
+                break;
+            }
+            step.cost = qMin(n, step.cost + plan[child].cost);
+        }
+        break;
+    default:
+        break;
+    }
+    plan.append(step);
+    return plan.size() - 1;
+}
+
+bool QueryPlanner::useIndex(const Step &step) const
+{
+    if (step.cost < 0) return false;
+    // 文本与分类/馆藏地址条件只能由索引求值，不论命中多少
+    const bool scannable = step.kind != QueryPredicate::Equals && step.kind != QueryPredicate::Contains;
+    return !scannable || step.cost <= columns_.size() / kIndexDivisor;
+}
+
+QVector<int> QueryPlanner::rows(const Plan &plan, int step) const
+{
+    if (useIndex(plan[step])) return drive(plan, step);
+    const QVector<quint64> bits = select(plan, step);
+    return ColumnKernels::rowsOf(bits.constData(), columns_.size());
+}
+
+QVector<int> QueryPlanner::drive(const Plan &plan, int step) const
+{
+    const Step &s = plan[step];
+    if (s.kind == QueryPredicate::Or) {
+        QVector<int> result;
+        for (int child : s.children) {
+            const QVector<int> more = drive(plan, child);
+            QVector<int> merged;
+            merged.reserve(result.size() + more.size());
+            std::set_union(result.cbegin(), result.cend(), more.cbegin(), more.cend(), std::back_inserter(merged));
+            result.swap(merged);
+        }
+        return result;
+    }
+    if (s.kind == QueryPredicate::And) {
+        int driver = -1;
+        for (int child : s.children) {
+            if (plan[child].cost == s.cost) {
+                driver = child;
+                break;
+            }
+        }
+        QVector<int> result = drive(plan, driver);
+        int kept = 0;
+        for (int row : result) {
+            bool ok = true;
+            for (int child : s.children) {
+                if (child != driver && !matches(plan, child, row)) {
+                    ok = false;
+                    break;
+                }
+            }
+            if (ok) result[kept++] = row;
+        }
+        result.resize(kept);
+        return result;
+    }
+    QVector<int> result = indexRows(s);
+    // 价格、归还日期索引按键排序，统一成行号升序
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+QVector<int> QueryPlanner::indexRows(const Step &step) const
+{
+    if (!step.supported) return QVector<int>();
+    switch (step.field) {
+    case QueryPredicate::CategoryField:
+        return categories_.rowsForCodes(step.codes);
+    case QueryPredicate::LocationField:
+        return locations_.rowsForCodes(step.codes);
+    case QueryPredicate::PriceField:
+        return prices_.rows(step.lower, step.upper);
+    case QueryPredicate::ReturnDateField: {
+        const qint32 first = lowerBound(step.lower, dayFloor());
+        const qint32 last = upperBound(step.upper);
+        if (first > last) return QVector<int>();
+        return dueDates_.rows(CatalogColumns::fromDay(first), CatalogColumns::fromDay(last));
+    }
+    case QueryPredicate::AnyTextField:
+        return text_.rowsContaining(step.text);
+    default:
+        break;
+    }
+    if (step.kind == QueryPredicate::Equals) {
+        if (step.field == QueryPredicate::IndexIdField) {
+            const int row = ids_.value(step.text, -1);
+            return row < 0 ? QVector<int>() : QVector<int>{ row };
+        }
+        return text_.rowsEqualTo(textField(step.field), step.text);
+    }
+    return text_.rowsContaining(textField(step.field), step.text);
+}
+
+QVector<quint64> QueryPlanner::select(const Plan &plan, int step) const
+{
+    const Step &s = plan[step];
+    const int n = columns_.size();
+    QVector<quint64> bits(ColumnKernels::wordCount(n));
+    if (useIndex(s)) {
+        setRows(drive(plan, step), bits.data());
+        return bits;
+    }
+    switch (s.kind) {
+    case QueryPredicate::MatchAll:
+        ColumnKernels::notBits(bits.constData(), bits.data(), n);
+        break;
+    case QueryPredicate::Available:
+        return availableSelection(columns_);
+    case QueryPredicate::Borrowed:
+        return borrowedSelection(columns_);
+    case QueryPredicate::Between:
+        BookFields::visitField(s.field, [&](auto field) {
+            typedef decltype(field) F;
+            if constexpr (F::numeric) selectRange<F>(columns_, s.lower, s.upper, bits.data());
+        });
+        break;
+    case QueryPredicate::And:
+    case QueryPredicate::Or:
+        bits = select(plan, s.children.first());
+        for (int i = 1; i < s.children.size(); ++i) {
+            const QVector<quint64> more = select(plan, s.children[i]);
+            if (s.kind == QueryPredicate::And) {
+                ColumnKernels::andBits(bits.constData(), more.constData(), bits.data(), n);
+            } else {
+                ColumnKernels::orBits(bits.constData(), more.constData(), bits.data(), n);
+            }
+        }
+        break;
+    case QueryPredicate::Not: {
+        const QVector<quint64> inner = select(plan, s.children.first());
+        ColumnKernels::notBits(inner.constData(), bits.data(), n);
+        break;
+    }
+    default:
+        break;
+    }
+    return bits;
+}
+
+bool QueryPlanner::matches(const Plan &plan, int step, int row) const
+{
+    const Step &s = plan[step];
+    switch (s.kind) {
+    case QueryPredicate::MatchAll:
+        return true;
+    case QueryPredicate::Available:
+        return columns_.available(row) && columns_.quantity(row) > 0;
+    case QueryPredicate::Borrowed:
+        return !columns_.available(row) || columns_.quantity(row) == 0;
+    case QueryPredicate::And:
+        for (int child : s.children) {
+            if (!matches(plan, child, row)) return false;
+        }
+        return true;
+    case QueryPredicate::Or:
+        for (int child : s.children) {
+            if (matches(plan, child, row)) return true;
+        }
+        return false;
+    case QueryPredicate::Not:
+        return !matches(plan, s.children.first(), row);
+    case QueryPredicate::Between: {
+        bool inRange = false;
+        BookFields::visitField(s.field, [&](auto field) {
+            typedef decltype(field) F;
+            if constexpr (F::numeric) inRange = BookFields::InRange<F>(columns_, s.lower, s.upper)(row);
+        });
+        return inRange;
+    }
+    default:
+        break;
+    }
+
+    // Equals / Contains
+    if (!s.supported) return false;
+    switch (s.field) {
+    case QueryPredicate::CategoryField:
+        return s.codeMatches[columns_.categoryCodes()[row]];
+    case QueryPredicate::LocationField:
+        return s.codeMatches[columns_.locationCodes()[row]];
+    case QueryPredicate::AnyTextField:
+        for (int field = 0; field < NGramIndex::FieldCount; ++field) {
+            if (text_.normalizedText(NGramIndex::Field(field), row).contains(s.text)) return true;
+        }
+        return false;
+    default:
+        break;
+    }
+    if (s.kind == QueryPredicate::Equals && s.field == QueryPredicate::IndexIdField) {
+        return columns_.indexId(row) == s.text;
+    }
+    const QString &text = text_.normalizedText(textField(s.field), row);
+    return s.kind == QueryPredicate::Equals ? text == s.text : text.contains(s.text);
+}
+
+void QueryPlanner::order(QVector<int> &rows, const CatalogQuery &query) const
+{
+    const int offset = qMin(query.offset(), int(rows.size()));
+    const int end = query.limitCount() < 0 ? rows.size() : int(qMin(qint64(rows.size()), qint64(offset) + query.limitCount()));
+    if (query.isOrdered()) {
+        const bool descending = query.sortOrder() == Qt::DescendingOrder;
+        BookFields::visitField(query.sortField(), [&](auto field) {
+            typedef decltype(field) F;
+            if (descending) {
+                sortRows(rows, end, BookFields::RowLess<F, true>(columns_));
+            } else {
+                sortRows(rows, end, BookFields::RowLess<F, false>(columns_));
+            }
+        });
+    }
+    if (offset > 0 || end < rows.size()) rows = rows.mid(offset, end - offset);
+}
@@ -0,0 +1,72 @@
+#ifndef QUERYPLANNER_H
+#define QUERYPLANNER_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "catalogquery.h"
+
+class CatalogColumns;
+class PostingListIndex;
+class PriceIndex;
+class DueDateIndex;
+class NGramIndex;
+
+// 组合查询（见 catalogquery.h）的规划与执行，直接读取 LibraryManager 的列和索引
+//
+// 先把谓词树编译一遍：分类/馆藏地址匹配出字典编码，文本关键字归一化，
+// 并为能由索引直接给出结果的节点估计命中数（倒排表长度、价格区间计数、最短 n-gram 倒排表）。
+// 执行时若估计命中数不超过总行数的一小部分，就由该索引产生候选行，再逐行核对其余条件；
+// 与节点在所有可由索引驱动的条件中挑估计最小的一个。否则在整列上用 columnkernels.h 的
+// 向量化内核生成选择位图，按与/或/非逐字合并。全程只处理行号和位图，不组装图书。
+class QueryPlanner {
+public:
+    QueryPlanner(const CatalogColumns &columns, const QHash<QString, int> &ids,
+                 const PostingListIndex &categories, const PostingListIndex &locations,
+                 const PriceIndex &prices, const DueDateIndex &dueDates, const NGramIndex &text);
+
+    // 满足查询的行号，已按查询排序并分页
+    QVector<int> execute(const CatalogQuery &query) const;
+
+    // 选择位图：可借且有库存 / 已借出或无库存（与 LibraryManager 的统计口径一致）
+    static QVector<quint64> availableSelection(const CatalogColumns &columns);
+    static QVector<quint64> borrowedSelection(const CatalogColumns &columns);
+
+private:
+    // 编译后的谓词节点，按下标存放在一个数组中，子节点记录下标
+    struct Step {
+        QueryPredicate::Kind kind = QueryPredicate::MatchAll;
+        QueryPredicate::Field field = QueryPredicate::NameField;
+        QString text;                // Equals/Contains 的取值，名称类字段已归一化
+        QVector<bool> codeMatches;   // 分类/馆藏地址：字典编码 -> 是否匹配
+        QVector<int> codes;          // 匹配的字典编码，升序
+        double lower = 0.0;
+        double upper = 0.0;
+        QVector<int> children;
+        bool supported = true;       // 字段与条件不搭配（如对价格做子串匹配）时不匹配任何图书
+        int cost = -1;               // 由索引直接产生结果时的命中数估计，-1 表示不能由索引产生
+    };
+    typedef QVector<Step> Plan;
+
+    int compile(const QueryPredicate &predicate, Plan &plan) const;
+    bool useIndex(const Step &step) const;
+    // 满足条件的行，升序
+    QVector<int> rows(const Plan &plan, int step) const;
+    QVector<int> drive(const Plan &plan, int step) const;
+    QVector<int> indexRows(const Step &step) const;
+    QVector<quint64> select(const Plan &plan, int step) const;
+    bool matches(const Plan &plan, int step, int row) const;
+    void order(QVector<int> &rows, const CatalogQuery &query) const;
+
+private:
+    const CatalogColumns &columns_;
+    const QHash<QString, int> &ids_;
+    const PostingListIndex &categories_;
+    const PostingListIndex &locations_;
+    const PriceIndex &prices_;
+    const DueDateIndex &dueDates_;
+    const NGramIndex &text_;
+};
+
+#endif // QUERYPLANNER_H
@@ -0,0 +1,34 @@
+#include "searchsnapshot.h"
+
+#include <QSet>
+
+SearchSnapshot::SearchSnapshot(const NGramIndex &textIndex, const PinyinIndex &pinyinIndex, quint64 version)
+    : textIndex_(textIndex)
+    , pinyinIndex_(pinyinIndex)
+    , version_(version)
+{
+}
+
+quint64 SearchSnapshot::version() const
+{
+    return version_;
+}
+
+QVector<int> SearchSnapshot::search(const QString &keyword, int limit) const
+{
+    return textIndex_.search(keyword, limit);
+}
+
+QVector<int> SearchSnapshot::fuzzySearch(const QString &keyword, int limit, const CancelCheck &cancelled) const
+{
+    if (keyword.trimmed().isEmpty()) return QVector<int>();
+    QVector<int> rows = textIndex_.search(keyword, limit);
+    if (limit >= 0 && rows.size() >= limit) return rows;
+    if (cancelled && cancelled()) return QVector<int>();
+    const QSet<int> found(rows.cbegin(), rows.cend());
+    for (int row : pinyinIndex_.search(keyword, limit)) {
+        if (limit >= 0 && rows.size() >= limit) break;
+        if (!found.contains(row)) rows.append(row);
+    }
+    return rows;
+}
@@ -0,0 +1,38 @@
+#ifndef SEARCHSNAPSHOT_H
+#define SEARCHSNAPSHOT_H
+
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+#include "ngramindex.h"
+#include "pinyinindex.h"
+
+// 检索索引在某一时刻的只读副本
+//
+// 索引内部全是隐式共享的 Qt 容器，复制只增加引用计数；之后界面线程修改索引时，
+// 被改动的部分自行分离，副本保持不变，可以交给工作线程检索。
+// 结果中的行号对应创建副本时的目录，version() 与 LibraryManager::catalogVersion() 不同时已失效。
+class SearchSnapshot {
+public:
+    // 返回 true 表示查询已作废，检索在各阶段之间检查并提前结束
+    typedef std::function<bool()> CancelCheck;
+
+    SearchSnapshot() = default;
+    SearchSnapshot(const NGramIndex &textIndex, const PinyinIndex &pinyinIndex, quint64 version);
+
+    quint64 version() const;
+
+    // 子串检索，见 NGramIndex::search
+    QVector<int> search(const QString &keyword, int limit = -1) const;
+    // 子串匹配在前，再补上拼音/首字母前缀与容错匹配，各组之间去重
+    QVector<int> fuzzySearch(const QString &keyword, int limit = -1, const CancelCheck &cancelled = CancelCheck()) const;
+
+private:
+    NGramIndex textIndex_;
+    PinyinIndex pinyinIndex_;
+    quint64 version_ = 0;
+};
+
+#endif // SEARCHSNAPSHOT_H
@@ -0,0 +1,221 @@
+#include "sortengine.h"
+
+#include <QSemaphore>
+#include <QThreadPool>
+
+#include "bookfields.h"
+#include "catalogcolumns.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+
+namespace {
+const int kRadixThreshold = 2048;        // 少于此行数时基数排序的计数开销不划算
+const int kParallelThreshold = 1 << 16;  // 少于此行数时并行的调度开销不划算
+const int kMinChunkRows = 1 << 14;       // 并行归并排序每段至少的行数
+
+// 保序映射：a < b 当且仅当 radixKey(a) < radixKey(b)
+inline quint64 radixKey(bool value) { return value ? 1 : 0; }
+inline quint64 radixKey(int value) { return quint32(value) ^ 0x80000000u; }
+inline quint64 radixKey(double value)
+{
+    if (value == 0.0) value = 0.0;   // -0.0 与 0.0 相等
+    quint64 bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return (bits >> 63) ? ~bits : bits | (quint64(1) << 63);
+}
+
+template <typename F>
+using KeyValue = typename std::decay<decltype(F::key(std::declval<const CatalogColumns &>())(0))>::type;
+
+template <typename F>
+constexpr bool radixable()
+{
+    return std::is_arithmetic<KeyValue<F>>::value;
+}
+
+bool radixable(const SortSpec &spec)
+{
+    for (const SortKey &k : spec) {
+        bool ok = false;
+        BookFields::visitField(k.field, [&](auto field) { ok = radixable<decltype(field)>(); });
+        if (!ok) return false;
+    }
+    return true;
+}
+
+// 按 keys[i]（与 rows[i] 对应）稳定排序，keys 随之重排
+void radixSort(QVector<int> &rows, QVector<quint64> &keys)
+{
+    const int n = rows.size();
+    QVector<quint64> counts(8 * 256, 0);
+    for (int i = 0; i < n; ++i) {
+        const quint64 k = keys[i];
+        for (int d = 0; d < 8; ++d) ++counts[d * 256 + int((k >> (8 * d)) & 0xff)];
+    }
+
+    QVector<int> rowBuffer(n);
+    QVector<quint64> keyBuffer(n);
+    int *srcRows = rows.data();
+    int *dstRows = rowBuffer.data();
+    quint64 *srcKeys = keys.data();
+    quint64 *dstKeys = keyBuffer.data();
+    for (int d = 0; d < 8; ++d) {
+        quint64 *count = counts.data() + d * 256;
+        const int shift = 8 * d;
+        if (count[(srcKeys[0] >> shift) & 0xff] == quint64(n)) continue;   // 这一字节全部相同
+        quint64 offset = 0;
+        for (int b = 0; b < 256; ++b) {
+            const quint64 c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for (int i = 0; i < n; ++i) {
+            const quint64 k = srcKeys[i];
+            const quint64 pos = count[(k >> shift) & 0xff]++;
+            dstKeys[pos] = k;
+            dstRows[pos] = srcRows[i];
+        }
+        std::swap(srcRows, dstRows);
+        std::swap(srcKeys, dstKeys);
+    }
+    if (srcRows != rows.data()) {
+        std::copy(srcRows, srcRows + n, rows.data());
+        std::copy(srcKeys, srcKeys + n, keys.data());
+    }
+}
+
+// 字节串键的前 8 个字节按大端拼成整数，不足补零：前缀整数不同时与整串的字节序一致
+quint64 prefixKey(const QByteArray &key)
+{
+    quint64 prefix = 0;
+    const int n = qMin(int(key.size()), 8);
+    for (int i = 0; i < n; ++i) prefix |= quint64(uchar(key.constData()[i])) << (56 - 8 * i);
+    return prefix;
+}
+
+// 逐键稳定排序，从最后一个键开始；初始为行号升序，故键全相同时行号小的在前
+void radixSort(QVector<int> &rows, const SortSpec &spec, const CatalogColumns &columns)
+{
+    QVector<quint64> keys(rows.size());
+    for (int i = spec.size() - 1; i >= 0; --i) {
+        const bool descending = spec[i].order == Qt::DescendingOrder;
+        BookFields::visitField(spec[i].field, [&](auto field) {
+            typedef decltype(field) F;
+            if constexpr (radixable<F>()) {
+                const auto key = F::key(columns);
+                for (int j = 0; j < rows.size(); ++j) {
+                    const quint64 k = radixKey(key(rows[j]));
+                    keys[j] = descending ? ~k : k;
+                }
+            }
+        });
+        radixSort(rows, keys);
+    }
+}
+
+// 在全局线程池上执行 task(0..count-1)，调用线程自己承担第 0 个并等待全部完成
+void runParallel(int count, const std::function<void(int)> &task)
+{
+    QSemaphore done;
+    for (int i = 1; i < count; ++i) {
+        QThreadPool::globalInstance()->start([&task, &done, i]() {
+            task(i);
+            done.release();
+        });
+    }
+    task(0);
+    done.acquire(count - 1);
+}
+
+// 字节串键（书名排序键）：先按 8 字节前缀基数排序，再把前缀相同的各段按整串比较排好
+template <typename F, bool Descending>
+void prefixSort(QVector<int> &rows, const CatalogColumns &columns)
+{
+    const auto key = F::key(columns);
+    const int n = rows.size();
+    QVector<quint64> prefixes(n);
+    for (int i = 0; i < n; ++i) {
+        const quint64 k = prefixKey(key(rows[i]));
+        prefixes[i] = Descending ? ~k : k;
+    }
+    radixSort(rows, prefixes);
+
+    const BookFields::RowLess<F, Descending> less(columns);
+    for (int begin = 0; begin < n;) {
+        int end = begin + 1;
+        while (end < n && prefixes[end] == prefixes[begin]) ++end;
+        if (end - begin > 1) std::sort(rows.begin() + begin, rows.begin() + end, less);
+        begin = end;
+    }
+}
+
+template <typename Less>
+void parallelSort(QVector<int> &rows, const Less &less)
+{
+    const int n = rows.size();
+    int chunks = 1;
+    const int threads = QThreadPool::globalInstance()->maxThreadCount();
+    while (chunks * 2 <= threads && n / (chunks * 2) >= kMinChunkRows) chunks *= 2;
+    if (n < kParallelThreshold || chunks < 2) {
+        std::sort(rows.begin(), rows.end(), less);
+        return;
+    }
+
+    QVector<int> bounds(chunks + 1);
+    for (int i = 0; i <= chunks; ++i) bounds[i] = int(qint64(n) * i / chunks);
+    int *src = rows.data();
+    runParallel(chunks, [&](int i) { std::sort(src + bounds[i], src + bounds[i + 1], less); });
+
+    QVector<int> buffer(n);
+    int *dst = buffer.data();
+    for (int width = 1; width < chunks; width *= 2) {
+        runParallel(chunks / (2 * width), [&](int i) {
+            const int lo = bounds[2 * i * width];
+            const int mid = bounds[(2 * i + 1) * width];
+            const int hi = bounds[(2 * i + 2) * width];
+            std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo, less);
+        });
+        std::swap(src, dst);
+    }
+    if (src != rows.data()) std::copy(src, src + n, rows.data());
+}
+
+} // namespace
+
+namespace SortEngine {
+
+QVector<int> sortedRows(const SortSpec &spec, const CatalogColumns &columns)
+{
+    QVector<int> rows(columns.size());
+    std::iota(rows.begin(), rows.end(), 0);
+    if (spec.isEmpty()) return rows;
+
+    if (rows.size() >= kRadixThreshold && radixable(spec)) {
+        radixSort(rows, spec, columns);
+        return rows;
+    }
+    // 单键时用字段描述的比较器，比较全部内联
+    const bool single = spec.size() == 1 && BookFields::visitField(spec.first().field, [&](auto field) {
+        typedef decltype(field) F;
+        if constexpr (std::is_same<KeyValue<F>, QByteArray>::value) {
+            if (rows.size() >= kRadixThreshold) {
+                if (spec.first().order == Qt::DescendingOrder) prefixSort<F, true>(rows, columns);
+                else prefixSort<F, false>(rows, columns);
+                return;
+            }
+        }
+        if (spec.first().order == Qt::DescendingOrder) {
+            parallelSort(rows, BookFields::RowLess<F, true>(columns));
+        } else {
+            parallelSort(rows, BookFields::RowLess<F, false>(columns));
+        }
+    });
+    if (!single) parallelSort(rows, RowOrder(spec, columns));
+    return rows;
+}
+
+} // namespace SortEngine
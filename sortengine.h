@@ -0,0 +1,24 @@
+#ifndef SORTENGINE_H
+#define SORTENGINE_H
+
+#include <QVector>
+
+#include "sortpermutations.h"
+
+class CatalogColumns;
+
+// 从零排出整列的行号排列（SortPermutations 首次使用某种顺序时调用）
+//
+// 整数类的键（借阅次数、数量、价格、儒略日、分类/馆藏地址的字典序名次）转成保序的
+// 64 位无符号数做 LSD 基数排序，每轮 8 位，取值全相同的字节跳过；多个键时从最后一个键
+// 起逐键稳定排序。单独按书名排序时先按排序键（见 ChineseText::sortKey）的前 8 个字节
+// 基数排序，再只对前缀相同的各段逐串比较。其余含文本键的排序按预先取好的比较键做归并排序：
+// 各段在全局线程池上并行排序，再逐轮两两归并。行数较少时直接走串行的 std::sort。
+// 结果与按 RowOrder 比较排序完全一致：键相同时行号小的在前。
+namespace SortEngine {
+
+QVector<int> sortedRows(const SortSpec &spec, const CatalogColumns &columns);
+
+} // namespace SortEngine
+
+#endif // SORTENGINE_H
@@ -0,0 +1,316 @@
+#include "sortpermutations.h"
+
+#include "bookfields.h"
+#include "catalogcolumns.h"
+#include "sortengine.h"
+
+#include <algorithm>
+
+namespace {
+const int kMaxCachedOrders = 8;   // 缓存的排列份数上限，超出时丢弃最久未用的一份（当前显示顺序除外）
+const int kBlockSize = 512;       // 排列分块的初始大小，块长到两倍时拆开
+
+template <typename T>
+int threeWay(const T &a, const T &b)
+{
+    return a < b ? -1 : (b < a ? 1 : 0);
+}
+
+} // namespace
+
+RowOrder::RowOrder(const SortSpec &spec, const CatalogColumns &columns)
+    : columns_(&columns)
+{
+    for (const SortKey &k : spec) {
+        if (!BookFields::visitField(k.field, [](auto) {})) continue;
+        keys_.append(Key{ k.field, k.order == Qt::DescendingOrder });
+        usesCategory_ = usesCategory_ || k.field == QueryPredicate::CategoryField;
+        usesLocation_ = usesLocation_ || k.field == QueryPredicate::LocationField;
+    }
+    sync();
+}
+
+void RowOrder::sync()
+{
+    if (usesCategory_ && categoryRanks_.size() != columns_->categoryDictionary().size()) {
+        categoryRanks_ = columns_->categoryDictionary().sortRanks();
+    }
+    if (usesLocation_ && locationRanks_.size() != columns_->locationDictionary().size()) {
+        locationRanks_ = columns_->locationDictionary().sortRanks();
+    }
+}
+
+int RowOrder::compare(const Key &key, int a, int b) const
+{
+    const CatalogColumns &c = *columns_;
+    switch (key.field) {
+    case QueryPredicate::CategoryField: {
+        const QVector<int> &codes = c.categoryCodes();
+        return threeWay(categoryRanks_[codes[a]], categoryRanks_[codes[b]]);
+    }
+    case QueryPredicate::LocationField: {
+        const QVector<int> &codes = c.locationCodes();
+        return threeWay(locationRanks_[codes[a]], locationRanks_[codes[b]]);
+    }
+    default:
+        break;
+    }
+    int result = 0;
+    BookFields::visitField(key.field, [&](auto field) {
+        const auto k = decltype(field)::key(c);
+        result = threeWay(k(a), k(b));
+    });
+    return result;
+}
+
+bool RowOrder::operator()(int a, int b) const
+{
+    for (const Key &k : keys_) {
+        const int c = compare(k, a, b);
+        if (c != 0) return k.descending ? c > 0 : c < 0;
+    }
+    return a < b;
+}
+
+// 一种顺序的行号排列，按位置分块存放
+//
+// 块编号分配后不变，order 记录各块的先后；每行记下所在的块和块内下标，
+// 位置 = 所在块的起始位置 + 块内下标。插入、取出一行只改写所在的一块和各块的起始位置，
+// 块过大时对半拆开；取空的块留到下次整体重排时再丢掉。
+struct SortPermutations::Entry {
+    Entry(const SortSpec &spec, const CatalogColumns &columns);
+
+    int rowAt(int position) const;
+    int positionOf(int row) const;
+    // [first, last) 中第一个不排在 row 之前的位置
+    int lowerBound(int row, int first, int last) const;
+    void insertAt(int position, int row);
+    void takeAt(int position);
+    void assign(const QVector<int> &sorted);
+    QVector<int> flatten() const;
+
+    SortSpec spec;
+    RowOrder less;
+    QVector<QVector<int>> blocks;   // 块编号 -> 块内的行号
+    QVector<int> order;             // 按位置先后排列的块编号
+    QVector<int> rankOf;            // 块编号 -> 在 order 中的下标
+    QVector<int> starts;            // order 中各块第一行的位置
+    QVector<int> blockOf;           // 行号 -> 块编号
+    QVector<int> slotOf;            // 行号 -> 块内下标
+    int count = 0;
+
+private:
+    int blockAt(int position) const;
+    void split(int index);
+};
+
+SortPermutations::Entry::Entry(const SortSpec &spec, const CatalogColumns &columns)
+    : spec(spec)
+    , less(spec, columns)
+{
+    assign(SortEngine::sortedRows(spec, columns));
+}
+
+void SortPermutations::Entry::assign(const QVector<int> &sorted)
+{
+    count = sorted.size();
+    blocks.clear();
+    order.clear();
+    rankOf.clear();
+    starts.clear();
+    blockOf.resize(count);
+    slotOf.resize(count);
+    for (int first = 0; first < count || blocks.isEmpty(); first += kBlockSize) {
+        const int id = blocks.size();
+        blocks.append(sorted.mid(first, kBlockSize));
+        order.append(id);
+        rankOf.append(id);
+        starts.append(first);
+        const QVector<int> &block = blocks.last();
+        for (int i = 0; i < block.size(); ++i) {
+            blockOf[block[i]] = id;
+            slotOf[block[i]] = i;
+        }
+    }
+}
+
+QVector<int> SortPermutations::Entry::flatten() const
+{
+    QVector<int> rows;
+    rows.reserve(count);
+    for (int id : order) rows += blocks[id];
+    return rows;
+}
+
+// 含 position 的块在 order 中的下标；起始位置不超过 position 的最后一块，
+// 空块与其后一块起始位置相同，不会被选中。position 等于总行数时为最后一块
+int SortPermutations::Entry::blockAt(int position) const
+{
+    return int(std::upper_bound(starts.begin(), starts.end(), position) - starts.begin()) - 1;
+}
+
+int SortPermutations::Entry::rowAt(int position) const
+{
+    const int index = blockAt(position);
+    return blocks[order[index]][position - starts[index]];
+}
+
+int SortPermutations::Entry::positionOf(int row) const
+{
+    return starts[rankOf[blockOf[row]]] + slotOf[row];
+}
+
+int SortPermutations::Entry::lowerBound(int row, int first, int last) const
+{
+    while (first < last) {
+        const int mid = first + (last - first) / 2;
+        if (less(rowAt(mid), row)) first = mid + 1;
+        else last = mid;
+    }
+    return first;
+}
+
+void SortPermutations::Entry::insertAt(int position, int row)
+{
+    const int index = blockAt(position);
+    const int id = order[index];
+    QVector<int> &block = blocks[id];
+    const int slot = position - starts[index];
+    block.insert(slot, row);
+    if (row >= blockOf.size()) {
+        blockOf.resize(row + 1);
+        slotOf.resize(row + 1);
+    }
+    blockOf[row] = id;
+    for (int i = slot; i < block.size(); ++i) slotOf[block[i]] = i;
+    for (int i = index + 1; i < starts.size(); ++i) ++starts[i];
+    ++count;
+    if (block.size() > 2 * kBlockSize) split(index);
+}
+
+void SortPermutations::Entry::takeAt(int position)
+{
+    const int index = blockAt(position);
+    QVector<int> &block = blocks[order[index]];
+    const int slot = position - starts[index];
+    block.removeAt(slot);
+    for (int i = slot; i < block.size(); ++i) slotOf[block[i]] = i;
+    for (int i = index + 1; i < starts.size(); ++i) --starts[i];
+    --count;
+}
+
+void SortPermutations::Entry::split(int index)
+{
+    const int id = order[index];
+    const int half = blocks[id].size() / 2;
+    const QVector<int> tail = blocks[id].mid(half);
+    blocks[id].resize(half);
+    const int tailId = blocks.size();
+    blocks.append(tail);
+    order.insert(index + 1, tailId);
+    starts.insert(index + 1, starts[index] + half);
+    rankOf.append(0);
+    for (int i = index + 1; i < order.size(); ++i) rankOf[order[i]] = i;
+    for (int i = 0; i < tail.size(); ++i) {
+        blockOf[tail[i]] = tailId;
+        slotOf[tail[i]] = i;
+    }
+}
+
+void SortPermutations::rebuild(const CatalogColumns &columns)
+{
+    entries_.clear();
+    current_.clear();
+    if (!currentSpec_.isEmpty()) current_ = take(currentSpec_, columns);
+}
+
+void SortPermutations::setCurrent(const SortSpec &spec, const CatalogColumns &columns)
+{
+    currentSpec_ = spec;
+    current_ = spec.isEmpty() ? EntryPtr() : take(spec, columns);
+}
+
+int SortPermutations::currentRow(int position) const
+{
+    return current_ ? current_->rowAt(position) : position;
+}
+
+int SortPermutations::currentPosition(int row) const
+{
+    return current_ ? current_->positionOf(row) : row;
+}
+
+QVector<int> SortPermutations::rows(const SortSpec &spec, const CatalogColumns &columns)
+{
+    if (spec.isEmpty()) return SortEngine::sortedRows(spec, columns);
+    return take(spec, columns)->flatten();
+}
+
+SortPermutations::EntryPtr SortPermutations::find(const SortSpec &spec) const
+{
+    for (const EntryPtr &entry : entries_) {
+        if (entry->spec == spec) return entry;
+    }
+    return EntryPtr();
+}
+
+// 取出 spec 的缓存（没有时排出一份）并标为最近使用
+SortPermutations::EntryPtr SortPermutations::take(const SortSpec &spec, const CatalogColumns &columns)
+{
+    EntryPtr entry = find(spec);
+    if (entry) {
+        entries_.removeOne(entry);
+    } else {
+        entry.reset(new Entry(spec, columns));
+        if (entries_.size() >= kMaxCachedOrders) {
+            for (int i = 0; i < entries_.size(); ++i) {
+                if (entries_[i] == current_) continue;
+                entries_.removeAt(i);
+                break;
+            }
+        }
+    }
+    entries_.append(entry);
+    return entry;
+}
+
+void SortPermutations::insert(int row)
+{
+    for (const EntryPtr &entry : entries_) {
+        Q_ASSERT(row == entry->count);
+        entry->less.sync();
+        entry->insertAt(entry->lowerBound(row, 0, entry->count), row);
+    }
+}
+
+void SortPermutations::update(int row)
+{
+    for (const EntryPtr &entry : entries_) {
+        entry->less.sync();
+        const RowOrder &less = entry->less;
+        const int pos = entry->positionOf(row);
+        if (pos > 0 && less(row, entry->rowAt(pos - 1))) {
+            // 前移：插到前面第一个不小于它的行之前
+            const int to = entry->lowerBound(row, 0, pos);
+            entry->takeAt(pos);
+            entry->insertAt(to, row);
+        } else if (pos + 1 < entry->count && less(entry->rowAt(pos + 1), row)) {
+            // 后移：取出后排到后面所有比它小的行之后
+            entry->takeAt(pos);
+            entry->insertAt(entry->lowerBound(row, pos, entry->count), row);
+        }
+        // 否则与相邻行的先后仍然成立，整个排列依旧有序
+    }
+}
+
+void SortPermutations::removeRow(int row)
+{
+    for (const EntryPtr &entry : entries_) {
+        QVector<int> rows = entry->flatten();
+        rows.removeAt(entry->positionOf(row));
+        for (int &r : rows) {
+            if (r > row) --r;
+        }
+        entry->assign(rows);
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef SORTPERMUTATIONS_H
+#define SORTPERMUTATIONS_H
+
+#include <QSharedPointer>
+#include <QVector>
+
+#include "catalogquery.h"
+
+class CatalogColumns;
+
+// 排序键：字段 + 方向。多个键依次比较（如先分类再名称），全部相同时按行号升序
+struct SortKey {
+    QueryPredicate::Field field;
+    Qt::SortOrder order = Qt::AscendingOrder;
+
+    bool operator==(const SortKey &other) const { return field == other.field && order == other.order; }
+    bool operator!=(const SortKey &other) const { return !(*this == other); }
+};
+typedef QVector<SortKey> SortSpec;
+
+// 按 SortSpec 比较两行；行号参与比较，任意两行都有确定的先后
+//
+// 只记住列存储的地址，每次比较现取各列，列在增删改后重新分配也不受影响。
+// 分类/馆藏地址按取值字典序的名次比较，名次在构造时取好，字典收录新取值后由 sync() 重取。
+class RowOrder {
+public:
+    RowOrder(const SortSpec &spec, const CatalogColumns &columns);
+    bool operator()(int a, int b) const;
+    // 字典大小变了才重新取名次，否则什么也不做
+    void sync();
+
+private:
+    struct Key {
+        QueryPredicate::Field field;
+        bool descending;
+    };
+    int compare(const Key &key, int a, int b) const;
+
+private:
+    const CatalogColumns *columns_;
+    QVector<Key> keys_;
+    QVector<int> categoryRanks_;
+    QVector<int> locationRanks_;
+    bool usesCategory_ = false;
+    bool usesLocation_ = false;
+};
+
+// 各排序方式下的行号排列缓存
+//
+// 排序不移动存储中的图书：每种 SortSpec 首次使用时排出一份行号排列（见 sortengine.h）并缓存，
+// 连同该顺序的比较器。排列分块存放（每块几百个行号），并记下每行所在的块和块内下标，
+// 行号与位置互查都不用扫描。增删改、借还时对每份缓存增量维护：新书按二分查找插入，
+// 编辑或借还后只在该行与相邻行的先后被打破时才把它挪到新位置，只改写涉及的一两块和
+// 各块的起始位置；删除图书时行号整体前移，才需要扫一遍排列。
+// 当前显示顺序（setCurrent）常驻缓存，其余顺序最多保留几份，最久未用的先丢弃。
+// 行号与 LibraryManager 中的下标一致，所有函数的 columns 都必须是同一份列存储。
+class SortPermutations {
+public:
+    // 丢弃所有缓存（columns 整体替换后调用），当前显示顺序按新内容重新排出
+    void rebuild(const CatalogColumns &columns);
+
+    // 设定当前显示顺序；spec 为空时为存储顺序
+    void setCurrent(const SortSpec &spec, const CatalogColumns &columns);
+    // 当前显示顺序下第 position 位的行号（在各块起始位置中二分）、行 row 所在的位置（直接查表）
+    int currentRow(int position) const;
+    int currentPosition(int row) const;
+
+    // 按 spec 排好序的全部行号；spec 为空时按存储顺序。每次调用都把各块拼成一份完整排列
+    QVector<int> rows(const SortSpec &spec, const CatalogColumns &columns);
+
+    // 以下在列存储改动之后调用。row 必须等于插入前的行数：LibraryManager 只在末尾追加图书
+    void insert(int row);
+    // 该行任一字段变化后调用
+    void update(int row);
+    void removeRow(int row);
+
+private:
+    struct Entry;   // 见 sortpermutations.cpp
+    typedef QSharedPointer<Entry> EntryPtr;
+
+    EntryPtr find(const SortSpec &spec) const;
+    EntryPtr take(const SortSpec &spec, const CatalogColumns &columns);
+
+private:
+    QVector<EntryPtr> entries_;   // 最近使用的在后，包含 current_
+    EntryPtr current_;            // 为空表示按存储顺序显示
+    SortSpec currentSpec_;
+};
+
+#endif // SORTPERMUTATIONS_H
@@ -0,0 +1,54 @@
+#include "stringdictionary.h"
+
+#include <algorithm>
+#include <numeric>
+
+void StringDictionary::clear()
+{
+    codes_.clear();
+    values_.clear();
+}
+
+int StringDictionary::intern(const QString &value)
+{
+    const auto it = codes_.constFind(value);
+    if (it != codes_.cend()) return it.value();
+    const int code = values_.size();
+    codes_.insert(value, code);
+    values_.append(value);
+    return code;
+}
+
+int StringDictionary::codeOf(const QString &value) const
+{
+    return codes_.value(value, -1);
+}
+
+const QString &StringDictionary::valueOf(int code) const
+{
+    return values_.at(code);
+}
+
+int StringDictionary::size() const
+{
+    return values_.size();
+}
+
+QVector<int> StringDictionary::sortRanks() const
+{
+    QVector<int> order(values_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](int a, int b) { return values_[a] < values_[b]; });
+    QVector<int> ranks(values_.size());
+    for (int i = 0; i < order.size(); ++i) ranks[order[i]] = i;
+    return ranks;
+}
+
+QVector<int> StringDictionary::codesContaining(const QString &needle, Qt::CaseSensitivity cs) const
+{
+    QVector<int> result;
+    for (int code = 0; code < values_.size(); ++code) {
+        if (values_[code].contains(needle, cs)) result.append(code);
+    }
+    return result;
+}
@@ -0,0 +1,33 @@
+#ifndef STRINGDICTIONARY_H
+#define STRINGDICTIONARY_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+// 字符串字典：为每个不同取值分配一个小整数编码（按首次出现的顺序）
+//
+// 用于分类、馆藏地址这类取值很少、重复很多的列。编码在 clear 之前保持不变，
+// 即使某个取值已经没有图书使用也不回收，调用方据倒排索引判断取值是否仍在使用。
+class StringDictionary {
+public:
+    void clear();
+
+    // 返回 value 的编码，未收录时新增
+    int intern(const QString &value);
+    // 未收录的取值返回 -1
+    int codeOf(const QString &value) const;
+    const QString &valueOf(int code) const;
+    int size() const;
+
+    // 每个编码在取值字典序中的名次，按名次比较整数即可代替字符串排序
+    QVector<int> sortRanks() const;
+    // 取值包含 needle 的编码，升序
+    QVector<int> codesContaining(const QString &needle, Qt::CaseSensitivity cs = Qt::CaseInsensitive) const;
+
+private:
+    QHash<QString, int> codes_;
+    QVector<QString> values_;
+};
+
+#endif // STRINGDICTIONARY_H
@@ -12,6 +12,30 @@ SOURCES += \
     main.cpp \
     mainwindow.cpp \
     librarymanager.cpp \
+    catalogcolumns.cpp \
+    columnkernels.cpp \
+    stringdictionary.cpp \
+    bookview.cpp \
+    booktablemodel.cpp \
+    catalogreader.cpp \
+    catalogsnapshot.cpp \
+    checksum.cpp \
+    circulationjournal.cpp \
+    postinglistindex.cpp \
+    priceindex.cpp \
+    duedateindex.cpp \
+    borrowrankindex.cpp \
+    ngramindex.cpp \
+    pinyinindex.cpp \
+    autocompletetrie.cpp \
+    searchsnapshot.cpp \
+    queryexecutor.cpp \
+    catalogquery.cpp \
+    queryplanner.cpp \
+    sortpermutations.cpp \
+    sortengine.cpp \
+    chinesetext.cpp \
+    chinesetextdata.cpp \
     bookdialog.cpp \
     splashscreen.cpp \
     logindialog.cpp
@@ -20,6 +44,31 @@ HEADERS += \
     mainwindow.h \
     book.h \
     librarymanager.h \
+    catalogcolumns.h \
+    columnkernels.h \
+    stringdictionary.h \
+    bookview.h \
+    booktablemodel.h \
+    catalogreader.h \
+    catalogsnapshot.h \
+    checksum.h \
+    circulationjournal.h \
+    postinglistindex.h \
+    priceindex.h \
+    duedateindex.h \
+    borrowrankindex.h \
+    ngramindex.h \
+    pinyinindex.h \
+    autocompletetrie.h \
+    searchsnapshot.h \
+    queryexecutor.h \
+    catalogquery.h \
+    queryplanner.h \
+    sortpermutations.h \
+    sortengine.h \
+    bookfields.h \
+    chinesetext.h \
+    chinesetextdata.h \
     bookdialog.h \
     splashscreen.h \
     logindialog.h